@@ -50,6 +50,18 @@ public:
     /// Compute points-to set for a context-sensitive pointer
     virtual const CxtPtSet& computeDDAPts(const CxtVar& cxtVar);
 
+    /// Write/merge the result of a query (see DDAClient::answerQueriesInWorkers)
+    //@{
+    virtual void writeDDAPts(NodeID id, std::ostream& os) override;
+    virtual void readDDAPts(std::istream& is) override;
+    //@}
+
+    /// Add indirect calls resolved by an earlier run
+    virtual void updateDDACallGraph(const CallEdgeMap& edges) override
+    {
+        addIndirectCallEdges(edges);
+    }
+
     /// Handle out-of-budget dpm
     void handleOutOfBudgetDpm(const CxtLocDPItem& dpm);
 
@@ -0,0 +1,70 @@
+/*
+ * DDACache.h
+ *
+ * Results of DDA queries kept in a file across runs, so that repeated queries
+ * on the same program are answered without traversing the SVFG again.
+ */
+
+#ifndef DDACACHE_H_
+#define DDACACHE_H_
+
+#include "MemoryModel/PointerAnalysis.h"
+
+namespace SVF
+{
+
+/*!
+ * Cached points-to of DDA queries and indirect calls resolved while answering
+ * them. Format of the file (one entry per line):
+ * dda-cache <key> <budget>
+ * query <result of a query, see PointerAnalysis::writeDDAPts>
+ * call <call site ICFG node id> <callee function object id>
+ */
+class DDACache
+{
+public:
+    typedef PointerAnalysis::CallEdgeMap CallEdgeMap;
+
+    DDACache(PointerAnalysis* p) : pta(p) {}
+
+    /// Load the results written for the same program and analysis. Results which
+    /// ran out of a smaller budget than the current one are left out so that they
+    /// are computed again. Returns false if there is nothing to load.
+    bool readFromFile(const std::string& filename);
+
+    /// Write the results of queries and the indirect calls resolved so far
+    void writeToFile(const std::string& filename, const std::vector<NodeID>& queries) const;
+
+    /// Cached queries
+    //@{
+    inline bool hasQuery(NodeID id) const
+    {
+        return queryToResult.find(id) != queryToResult.end();
+    }
+    void answerQuery(NodeID id) const;
+    inline u32_t getQueryNum() const
+    {
+        return queryToResult.size();
+    }
+    //@}
+
+    /// Indirect calls resolved by the run which wrote the cache
+    inline const CallEdgeMap& getCallEdges() const
+    {
+        return callEdges;
+    }
+
+private:
+    /// Hash of the program and of the options the results depend on
+    std::string getCacheKey() const;
+    /// Step budget of a query
+    u64_t getBudget() const;
+
+    PointerAnalysis* pta;
+    Map<NodeID, std::string> queryToResult;
+    CallEdgeMap callEdges;
+};
+
+} // End namespace SVF
+
+#endif /* DDACACHE_H_ */
@@ -25,7 +25,7 @@ namespace SVF
 class DDAClient
 {
 public:
-    DDAClient(SVFModule* mod) : pag(nullptr), module(mod), curPtr(0), solveAll(true) {}
+    DDAClient(SVFModule* mod) : pag(nullptr), module(mod), curPtr(0), budgetPool(0), budgetUsed(0), queryBudget(0), startTime(0), solveAll(true) {}
 
     virtual ~DDAClient() {}
 
@@ -75,6 +75,18 @@ public:
     }
     virtual void answerQueries(PointerAnalysis* pta);
 
+    /// Step budget of the current query, i.e., its share of -dda-budget-pool,
+    /// or fixedBudget (the analysis' own budget) without a pool
+    inline u64_t getQueryBudget(u64_t fixedBudget) const
+    {
+        return queryBudget != 0 ? queryBudget : fixedBudget;
+    }
+    /// Steps taken by the analysis for the current query
+    inline void addQuerySteps(u64_t steps)
+    {
+        budgetUsed += steps;
+    }
+
     virtual inline void performStat(PointerAnalysis*) {}
 
     virtual inline void collectWPANum(SVFModule*) {}
@@ -85,10 +97,21 @@ protected:
             candidateQueries.insert(id);
     }
 
+    /// Answer the queries with a number of forked copies of the analysis
+    void answerQueriesInWorkers(PointerAnalysis* pta, const std::vector<NodeID>& queries, u32_t numOfWorkers);
+
+    /// Compute the points-to of a query within its share of the budgets,
+    /// pendingQueries being the number of queries left including this one
+    void computeQuery(PointerAnalysis* pta, NodeID id, u32_t pendingQueries);
+
     SVFIR*   pag;					///< SVFIR graph used by current DDA analysis
     SVFModule* module;		///< LLVM module
     NodeID curPtr;				///< current pointer being queried
     OrderedNodeSet candidateQueries;	///< store all candidate pointers to be queried
+    u64_t budgetPool;			///< steps shared by the queries (-dda-budget-pool)
+    u64_t budgetUsed;			///< steps of the pool taken so far
+    u64_t queryBudget;			///< budget of the current query, 0 if fixed
+    double startTime;			///< time when answering queries started
 
 private:
     OrderedNodeSet userInput;           ///< User input queries
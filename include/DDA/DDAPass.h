@@ -58,6 +58,12 @@ public:
 private:
     /// Print queries' pts
     void printQueryPTS();
+    /// Answer requests from stdin or a Unix domain socket (-serve)
+    void serveQueries();
+    /// Answer the requests read from in, returns true after a quit request
+    bool serveQueries(FILE* in, FILE* out);
+    /// Answer a single request of -serve
+    std::string answerRequest(const std::string& request);
     /// Create pointer analysis according to specified kind and analyze the module.
     void runPointerAnalysis(SVFModule* module, u32_t kind);
     /// Context insensitive Edge for DDA
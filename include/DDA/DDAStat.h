@@ -43,6 +43,23 @@ public:
 
     NodeBS _StrongUpdateStores;
 
+    u32_t _NumOfTimedOutQueries;
+
+    u64_t _NumOfCacheLookups;	///< findPT calls of the current query
+    u64_t _NumOfCacheHits;		///< findPT calls answered from the backward visited dpms
+
+    /// Record the step budget given to a query (see DDAClient::computeQuery)
+    inline void addQueryBudget(u64_t budget)
+    {
+        if (_NumOfBudgetedQueries == 0 || budget < _MinQueryBudget)
+            _MinQueryBudget = budget;
+        if (budget > _MaxQueryBudget)
+            _MaxQueryBudget = budget;
+        _TotalQueryBudget += budget;
+        _NumOfBudgetedQueries++;
+        _QueryBudgeted = true;
+    }
+
     void performStatPerQuery(NodeID ptr) override;
 
     void performStat() override;
@@ -66,9 +83,27 @@ public:
     }
 
 private:
+    /// What is kept of every query for distributions and the slowest queries
+    struct QueryStat
+    {
+        NodeID ptr;
+        NodeID startNode;	///< SVFG node the query starts from
+        double time;
+        u64_t steps;
+        u32_t svfgNodes;	///< SVFG nodes visited
+        u32_t dpms;
+        u64_t cacheLookups;
+        u64_t cacheHits;
+        const char* outOfBudget;	///< why the query ran out of budget, nullptr if it did not
+    };
+
     FlowDDA* flowDDA;
     ContextDDA* contextDDA;
 
+    std::vector<QueryStat> queryStats;
+    bool _QueryBudgeted;
+    u32_t _LastNumOfTimedOutQueries;
+
     u32_t _TotalNumOfQuery;
     u32_t _TotalNumOfOutOfBudgetQuery;
     u32_t _TotalNumOfDPM;
@@ -93,6 +128,11 @@ private:
     u32_t _vmsizeUsageBefore;
     u32_t _vmsizeUsageAfter;
 
+    u32_t _NumOfBudgetedQueries;
+    u64_t _MinQueryBudget;
+    u64_t _MaxQueryBudget;
+    u64_t _TotalQueryBudget;
+
     double _AvgNumOfDPMAtSVFGNode;
     u32_t _MaxNumOfDPMAtSVFGNode;
 
@@ -100,6 +140,13 @@ private:
 
     void initDefault();
 
+    /// Percentiles of time and steps over all queries
+    void performQueryDistributionStat();
+
+    void printSlowestQueries();
+
+    void writeQueryStatsToJSON(const std::string& filename);
+
 public:
     SVFG* getSVFG() const;
 
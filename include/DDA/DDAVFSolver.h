@@ -12,6 +12,7 @@
 #include "MSSA/SVFGBuilder.h"
 #include "WPA/Andersen.h"
 #include "Util/SCC.h"
+#include "Util/Options.h"
 #include "MemoryModel/PointsTo.h"
 #include <algorithm>
 
@@ -31,16 +32,20 @@ public:
     typedef PTACallGraphEdge::CallInstSet CallInstSet;
     typedef SVFIR::CallSiteSet CallSiteSet;
     typedef OrderedSet<DPIm> DPTItemSet;
-    typedef OrderedMap<DPIm, CPtSet> DPImToCPtSetMap;
-    typedef OrderedMap<DPIm,CVar> DPMToCVarMap;
-    typedef OrderedMap<DPIm,DPIm> DPMToDPMMap;
+    /// Containers of dpms which are only looked up, never iterated
+    //@{
+    typedef Set<DPIm> DPTItemHashSet;
+    typedef Map<DPIm, CPtSet> DPImToCPtSetMap;
+    typedef Map<DPIm,CVar> DPMToCVarMap;
+    typedef Map<DPIm,DPIm> DPMToDPMMap;
+    //@}
     typedef OrderedMap<NodeID, DPTItemSet> LocToDPMVecMap;
     typedef OrderedSet<const SVFGEdge* > ConstSVFGEdgeSet;
     typedef SVFGEdge::SVFGEdgeSetTy SVFGEdgeSet;
     typedef OrderedMap<const SVFGNode*, DPTItemSet> StoreToPMSetMap;
 
     ///Constructor
-    DDAVFSolver(): outOfBudgetQuery(false),_pag(nullptr),_svfg(nullptr),_ander(nullptr),_callGraph(nullptr), _callGraphSCC(nullptr), _svfgSCC(nullptr), ddaStat(nullptr)
+    DDAVFSolver(): outOfBudgetQuery(false),_pag(nullptr),_svfg(nullptr),_ander(nullptr),_callGraph(nullptr), _callGraphSCC(nullptr), _svfgSCC(nullptr), ddaStat(nullptr), svfgBuilder(false, Options::LazySVFG)
     {
     }
     /// Destructor
@@ -116,8 +121,10 @@ public:
     virtual const CPtSet& findPT(const DPIm& dpm)
     {
 
+        DOSTAT(ddaStat->_NumOfCacheLookups++);
         if(isbkVisited(dpm))
         {
+            DOSTAT(ddaStat->_NumOfCacheHits++);
             const CPtSet& cpts = getCachedPointsTo(dpm);
             DBOUT(DDDA, SVFUtil::outs() << "\t already backward visited dpm: ");
             DBOUT(DDDA, dpm.dump());
@@ -241,6 +248,7 @@ protected:
         reComputeForEdges(dpm,newIndirectEdges,true);
 
         /// re-compute for transitive closures
+        getSVFG()->expandForTraversal(dpm.getLoc());
         SVFGEdgeSet edgeSet(dpm.getLoc()->getOutEdges());
         reComputeForEdges(dpm,edgeSet,false);
     }
@@ -328,6 +336,7 @@ protected:
         NodeID obj = oldDpm.getCurNodeID();
         if (_pag->isConstantObj(obj) || _pag->isNonPointerObj(obj))
             return;
+        getSVFG()->expandForTraversal(node);
         const SVFGEdgeSet edgeSet(node->getInEdges());
         for (SVFGNode::const_iterator it = edgeSet.begin(), eit = edgeSet.end(); it != eit; ++it)
         {
@@ -510,6 +519,31 @@ protected:
     virtual inline void updateCallGraphAndSVFG(const DPIm&, const CallICFGNode*, SVFGEdgeSet&) {}
     //@}
 
+    /// Add indirect calls which are already known to the call graph and SVFG
+    void addIndirectCallEdges(const PTACallGraph::CallEdgeMap& edges)
+    {
+        PTACallGraph::CallEdgeMap newEdges;
+        for (PTACallGraph::CallEdgeMap::const_iterator it = edges.begin(), eit = edges.end(); it != eit; ++it)
+        {
+            const CallICFGNode* cs = it->first;
+            for (const SVFFunction* callee : it->second)
+            {
+                if (0 == _callGraph->getIndCallMap()[cs].count(callee))
+                {
+                    newEdges[cs].insert(callee);
+                    _callGraph->getIndCallMap()[cs].insert(callee);
+                    _callGraph->addIndirectCallGraphEdge(cs, cs->getCaller(), callee);
+                }
+            }
+        }
+        if (newEdges.empty())
+            return;
+
+        SVFGEdgeSet svfgEdges;
+        getSVFG()->connectCallerAndCallee(newEdges, svfgEdges);
+        _callGraphSCC->find();
+    }
+
     ///Visited flags to avoid cycles
     //@{
     inline void markbkVisited(const DPIm& dpm)
@@ -757,13 +791,13 @@ protected:
     PTACallGraph* _callGraph;		///< CallGraph
     CallGraphSCC* _callGraphSCC;	///< SCC for CallGraph
     SVFGSCC* _svfgSCC;				///< SCC for SVFG
-    DPTItemSet backwardVisited;		///< visited map during backward traversing
+    DPTItemHashSet backwardVisited;	///< visited map during backward traversing
     DPImToCPtSetMap dpmToTLCPtSetMap;	///< points-to caching map for top-level vars
     DPImToCPtSetMap dpmToADCPtSetMap;	///< points-to caching map for address-taken vars
     LocToDPMVecMap locToDpmSetMap;	///< map location to its dpms
     DPMToDPMMap dpmToloadDpmMap;		///< dpms at loads for may/must-alias analysis with stores
     DPMToCVarMap loadToPTCVarMap;	///< map a load dpm to its cvar pointed by its pointer operand
-    DPTItemSet outOfBudgetDpms;		///< out of budget dpm set
+    DPTItemHashSet outOfBudgetDpms;	///< out of budget dpm set
     StoreToPMSetMap storeToDPMs;	///< map store to set of DPM which have been stong updated there
     DDAStat* ddaStat;				///< DDA stat
     SVFGBuilder svfgBuilder;			///< SVFG Builder
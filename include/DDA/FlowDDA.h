@@ -44,6 +44,18 @@ public:
     /// Compute points-to set for all top variable
     void computeDDAPts(NodeID id) override;
 
+    /// Write/merge the result of a query (see DDAClient::answerQueriesInWorkers)
+    //@{
+    void writeDDAPts(NodeID id, std::ostream& os) override;
+    void readDDAPts(std::istream& is) override;
+    //@}
+
+    /// Add indirect calls resolved by an earlier run
+    void updateDDACallGraph(const CallEdgeMap& edges) override
+    {
+        addIndirectCallEdges(edges);
+    }
+
     /// Handle out-of-budget dpm
     void handleOutOfBudgetDpm(const LocDPItem& dpm);
 
@@ -104,12 +104,14 @@ protected:
     SVFGStat * stat;
     MemSSA* mssa;
     PointerAnalysis* pta;
+    bool lazy;	///< memory SSA and address-taken nodes/edges are built per function on demand
+    Set<const SVFFunction*> expandedFuns;	///< functions built so far when lazy
 
     /// Clean up memory
     void destroy();
 
     /// Constructor
-    SVFG(MemSSA* mssa, VFGK k);
+    SVFG(MemSSA* mssa, VFGK k, bool lazy = false);
 
     /// Start building SVFG
     virtual void buildSVFG();
@@ -158,6 +160,22 @@ public:
         return hasVFGNode(id);
     }
 
+    /// Lazily built SVFG
+    //@{
+    inline bool isLazy() const
+    {
+        return lazy;
+    }
+    /// Build the address-taken part of the SVFG for fun if not done yet
+    void expandFunction(const SVFFunction* fun);
+    /// To be called before traversing the edges of node
+    inline void expandForTraversal(const SVFGNode* node)
+    {
+        if (lazy)
+            expandNode(node);
+    }
+    //@}
+
     /// Get all inter value flow edges of a indirect call site
     void getInterVFEdgesForIndirectCallSite(const CallICFGNode* cs, const SVFFunction* callee, SVFGEdgeSetTy& edges);
 
@@ -167,11 +185,18 @@ public:
     /// Connect SVFG nodes between caller and callee for indirect call site
     virtual void connectCallerAndCallee(const CallICFGNode* cs, const SVFFunction* callee, SVFGEdgeSetTy& edges);
 
+    /// Connect all the (call site, callee) pairs found by one call graph update
+    void connectCallerAndCallee(const PTACallGraph::CallEdgeMap& newEdges, SVFGEdgeSetTy& edges);
+
     /// Given a pagNode, return its definition site
     inline const SVFGNode* getDefSVFGNode(const PAGNode* pagNode) const
     {
         return getSVFGNode(getDef(pagNode));
     }
+    inline bool hasDefSVFGNode(const PAGNode* pagNode) const
+    {
+        return hasDef(pagNode);
+    }
 
     /// Perform statistics
     void performStat();
@@ -384,6 +409,18 @@ protected:
     void addSVFGNodesForAddrTakenVars();
     /// Connect direct SVFG edges between two SVFG nodes (value-flow of top address-taken variables)
     void connectIndirectSVFGEdges();
+    /// Connect the indirect SVFG edges of a node
+    void connectIndirectSVFGEdges(const SVFGNode* node);
+    /// Intra-procedural indirect edges (src, dst, points-to) collected before being added
+    typedef std::vector<std::tuple<NodeID, NodeID, const NodeBS*>> IndirectVFEdgeList;
+    /// Collect the intra-procedural indirect edges into node (only reads the SVFG and memory SSA)
+    void collectIntraIndirectVFEdges(const SVFGNode* node, IndirectVFEdgeList& edges) const;
+    /// Connect the inter-procedural indirect edges of formal-ins/outs
+    void connectInterIndirectSVFGEdges(const SVFGNode* node);
+    /// Create SVFG nodes for address-taken variables of a function (lazy SVFG)
+    void addSVFGNodesForAddrTakenVars(const SVFFunction* fun, NodeBS& nodes);
+    /// Expand the functions whose nodes/edges a traversal from node may need (lazy SVFG)
+    void expandNode(const SVFGNode* node);
     /// Connect indirect SVFG edges from global initializers (store) to main function entry
     void connectFromGlobalToProgEntry();
 
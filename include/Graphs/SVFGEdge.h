@@ -32,6 +32,7 @@
 
 #include "MSSA/MemSSA.h"
 #include "Graphs/VFGEdge.h"
+#include "MemoryModel/PersistentPointsToCache.h"
 
 namespace SVF
 {
@@ -45,24 +46,37 @@ class IndirectSVFGEdge : public VFGEdge
 public:
     typedef Set<const MRVer*> MRVerSet;
 private:
-    NodeBS cpts;
+    PointsToID cpts;    ///< Interned in getPtsCache()
 public:
     /// Constructor
-    IndirectSVFGEdge(VFGNode* s, VFGNode* d, GEdgeFlag k): VFGEdge(s,d,k)
+    IndirectSVFGEdge(VFGNode* s, VFGNode* d, GEdgeFlag k): VFGEdge(s,d,k),
+        cpts(PersistentPointsToCache<NodeBS>::emptyPointsToId())
     {
     }
     /// Handle memory region
     //@{
     inline bool addPointsTo(const NodeBS& c)
     {
-        return (cpts |= c);
+        PersistentPointsToCache<NodeBS>& ptsCache = getPtsCache();
+        PointsToID newPts = ptsCache.unionPts(cpts, ptsCache.emplacePts(c));
+        if (newPts == cpts)
+            return false;
+        cpts = newPts;
+        return true;
     }
     inline const NodeBS& getPointsTo() const
+    {
+        return getPtsCache().getActualPts(cpts);
+    }
+    inline PointsToID getPointsToID() const
     {
         return cpts;
     }
     //@}
 
+    /// Points-to sets of all indirect edges
+    static PersistentPointsToCache<NodeBS>& getPtsCache();
+
     /// Methods for support type inquiry through isa, cast, and dyn_cast:
     //@{
     static inline bool classof(const IndirectSVFGEdge *)
@@ -42,16 +42,16 @@ namespace SVF
 class MRSVFGNode : public VFGNode
 {
 protected:
-    NodeBS cpts;
+    const MemRegion* mr;    ///< Shared with the memory SSA rather than copying its points-to
 
     // This constructor can only be used by derived classes
-    MRSVFGNode(NodeID id, VFGNodeK k) : VFGNode(id, k) {}
+    MRSVFGNode(NodeID id, VFGNodeK k, const MemRegion* m) : VFGNode(id, k), mr(m) {}
 
 public:
     /// Return points-to of the MR
     inline const NodeBS& getPointsTo() const
     {
-        return cpts;
+        return mr->getPointsTo();
     }
 
     inline const NodeBS getDefSVFVars() const override;
@@ -98,9 +98,8 @@ private:
 
 public:
     /// Constructor
-    FormalINSVFGNode(NodeID id, const MRVer* resVer, const FunEntryICFGNode* funEntry): MRSVFGNode(id, FPIN)
+    FormalINSVFGNode(NodeID id, const MRVer* resVer, const FunEntryICFGNode* funEntry): MRSVFGNode(id, FPIN, resVer->getMR())
     {
-        cpts = resVer->getMR()->getPointsTo();
         ver = resVer;
         funEntryNode = funEntry;
     }
@@ -185,9 +184,8 @@ private:
 public:
     /// Constructor
     ActualINSVFGNode(NodeID id, const CallICFGNode* c, const MRVer* mrver):
-        MRSVFGNode(id, APIN), cs(c)
+        MRSVFGNode(id, APIN, mrver->getMR()), cs(c)
     {
-        cpts = mrver->getMR()->getPointsTo();
         ver = mrver;
     }
     /// Callsite
@@ -235,9 +233,8 @@ private:
 public:
     /// Constructor
     ActualOUTSVFGNode(NodeID id, const CallICFGNode* cal, const MRVer* resVer):
-        MRSVFGNode(id, APOUT), cs(cal)
+        MRSVFGNode(id, APOUT, resVer->getMR()), cs(cal)
     {
-        cpts = resVer->getMR()->getPointsTo();
         ver = resVer;
     }
     /// Callsite
@@ -276,7 +273,8 @@ public:
 class MSSAPHISVFGNode : public MRSVFGNode
 {
 public:
-    typedef Map<u32_t,const MRVer*> OPVers;
+    /// Operands in the order they were set; phis have few of them
+    typedef std::vector<std::pair<u32_t,const MRVer*>> OPVers;
 
 protected:
     const MRVer* ver;
@@ -284,9 +282,8 @@ protected:
 
 public:
     /// Constructor
-    MSSAPHISVFGNode(NodeID id, const MRVer* resVer,VFGNodeK k = MPhi): MRSVFGNode(id, k)
+    MSSAPHISVFGNode(NodeID id, const MRVer* resVer,VFGNodeK k = MPhi): MRSVFGNode(id, k, resVer->getMR())
     {
-        cpts = resVer->getMR()->getPointsTo();
         ver = resVer;
     }
     /// Ver
@@ -298,13 +295,25 @@ public:
     //@{
     inline const MRVer* getOpVer(u32_t pos) const
     {
-        OPVers::const_iterator it = opVers.find(pos);
-        assert(it!=opVers.end() && "version is nullptr, did not rename?");
-        return it->second;
+        for (const OPVers::value_type& opVer : opVers)
+        {
+            if (opVer.first == pos)
+                return opVer.second;
+        }
+        assert(false && "version is nullptr, did not rename?");
+        return nullptr;
     }
     inline void setOpVer(u32_t pos, const MRVer* node)
     {
-        opVers[pos] = node;
+        for (OPVers::value_type& opVer : opVers)
+        {
+            if (opVer.first == pos)
+            {
+                opVer.second = node;
+                return;
+            }
+        }
+        opVers.push_back(std::make_pair(pos, node));
     }
     inline u32_t getOpVerNum() const
     {
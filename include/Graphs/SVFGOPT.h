@@ -190,7 +190,14 @@ private:
     //@{
     /// Record def sites of actual-in/formal-out and connect from those def-sites
     /// to formal-in/actual-out directly if they exist.
-    void retargetEdgesOfAInFOut(SVFGNode* node);
+    void retargetEdgesOfAInFOut(const std::vector<SVFGNode*>& nodes);
+    /// Def site of an actual-in/formal-out and the edges to retarget from it
+    struct AInFOutRetarget
+    {
+        NodeID def;
+        std::vector<std::pair<const IndirectSVFGEdge*, NodeBS>> outEdges;
+    };
+    void collectRetargetedEdges(const SVFGNode* node, AInFOutRetarget& retarget) const;
     /// Connect actual-out/formal-in's predecessors to their successors directly.
     void retargetEdgesOfAOutFIn(SVFGNode* node);
     //@}
@@ -156,6 +156,18 @@ public:
         svfgOptTimeEnd = PTAStat::getClk(true);
     }
 
+    inline void setMemUsageBefore(u32_t vmrss, u32_t vmsize)
+    {
+        _vmrssUsageBefore = vmrss;
+        _vmsizeUsageBefore = vmsize;
+    }
+
+    inline void setMemUsageAfter(u32_t vmrss, u32_t vmsize)
+    {
+        _vmrssUsageAfter = vmrss;
+        _vmsizeUsageAfter = vmsize;
+    }
+
 private:
     void clear();
 
@@ -195,6 +207,7 @@ private:
     int totalIndInEdge;	///< Total number of indirect SVFG edges
     int totalIndOutEdge;
     int totalIndEdgeLabels; ///< Total number of l --o--> lp
+    Set<PointsToID> indEdgeLabelSets;   ///< Distinct (shared) labels of indirect edges
 
     int totalIndCallEdge;
     int totalIndRetEdge;
@@ -228,6 +241,11 @@ private:
     double svfgOptTimeStart;
     double svfgOptTimeEnd;
 
+    u32_t _vmrssUsageBefore;
+    u32_t _vmrssUsageAfter;
+    u32_t _vmsizeUsageBefore;
+    u32_t _vmsizeUsageAfter;
+
     SVFGNodeSet forwardSlice;
     SVFGNodeSet backwardSlice;
     SVFGNodeSet	sources;
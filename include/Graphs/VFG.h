@@ -82,6 +82,8 @@ public:
     typedef SVFIR::SVFStmtSet SVFStmtSet;
     typedef Set<const VFGNode*> GlobalVFGNodeSet;
     typedef Set<const PAGNode*> PAGNodeSet;
+    /// Intra-procedural direct edges (src, dst) collected before being added
+    typedef std::vector<std::pair<NodeID, NodeID>> DirectVFEdgeList;
 
 
 protected:
@@ -450,6 +452,10 @@ protected:
 
     /// Create edges between VFG nodes within a function
     void connectDirectVFGEdges();
+    /// Collect the intra-procedural direct edges into node (only reads the VFG)
+    void collectIntraDirectVFEdges(const VFGNode* node, DirectVFEdgeList& edges) const;
+    /// Group nodes by their function (nodes of globals form one group)
+    void getNodesOfFunctions(std::vector<std::vector<const VFGNode*>>& funNodes) const;
 
     /// Create edges between VFG nodes across functions
     void addVFGInterEdges(const CallICFGNode* cs, const SVFFunction* callee);
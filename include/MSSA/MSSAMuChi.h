@@ -31,6 +31,7 @@
 #define MSSAMUCHI_H_
 
 #include "MSSA/MemRegion.h"
+#include <atomic>
 
 namespace SVF
 {
@@ -47,7 +48,7 @@ public:
     typedef MSSADEF MSSADef;
 private:
     /// ver ID 0 is reserved
-    static u32_t totalVERNum;
+    static std::atomic<u32_t> totalVERNum;
     const MemRegion* mr;
     MRVERSION version;
     MRVERID vid;
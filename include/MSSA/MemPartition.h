@@ -47,6 +47,8 @@ namespace SVF
 class DistinctMRG : public MRGenerator
 {
 public:
+    typedef Map<NodeID, const MemRegion*> ObjToMRMap;
+
     DistinctMRG(BVDataPTAImpl* p, bool ptrOnly) : MRGenerator(p, ptrOnly)
     {}
 
@@ -65,6 +67,9 @@ private:
     /// Create memory regions for each points-to target.
     void createDistinctMR(const SVFFunction* func, const NodeBS& cpts);
 
+    /// The single-object region of each points-to target
+    ObjToMRMap objToMRMap;
+
 };
 
 /*!
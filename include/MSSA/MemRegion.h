@@ -140,6 +140,8 @@ public:
     typedef Map<const SVFFunction*, NodeBS> FunToPointsToMap;
     typedef Map<const SVFFunction*, PointsToList> FunToPointsTosMap;
     typedef OrderedMap<NodeBS, NodeBS, SVFUtil::equalNodeBS> PtsToRepPtsSetMap;
+    /// Map a conditional pts (or rep pts) to its memory region
+    typedef Map<NodeBS, const MemRegion*, SVFUtil::hashNodeBS> PtsToMRMap;
 
     /// Map a function to its region set
     typedef Map<const SVFFunction*, MRSet> FunToMRsMap;
@@ -168,6 +170,16 @@ public:
 
     typedef Map<NodeID, NodeBS> NodeToPTSSMap;
 
+    /// Side effects found by one thread while processing a level of call
+    /// graph SCCs, merged into the maps above once the level is done.
+    struct ModRefDelta
+    {
+        FunToPointsToMap funToRefs;
+        FunToPointsToMap funToMods;
+        CallSiteToPointsToMap csToRefs;
+        CallSiteToPointsToMap csToMods;
+    };
+
     /// SVFIR edge list
     typedef SVFIR::SVFStmtList SVFStmtList;
     /// Call Graph SCC
@@ -248,14 +260,18 @@ private:
     NodeBS& CollectPtsChain(NodeID id);
 
     /// Return the pts chain of all callsite arguments
-    inline NodeBS& getCallSiteArgsPts(const CallICFGNode* cs)
+    inline const NodeBS& getCallSiteArgsPts(const CallICFGNode* cs) const
     {
-        return csToCallSiteArgsPtsMap[cs];
+        CallSiteToPointsToMap::const_iterator it = csToCallSiteArgsPtsMap.find(cs);
+        assert(it!=csToCallSiteArgsPtsMap.end() && "callsite pts not collected??");
+        return it->second;
     }
     /// Return the pts chain of the return parameter of the callsite
-    inline NodeBS& getCallSiteRetPts(const CallICFGNode* cs)
+    inline const NodeBS& getCallSiteRetPts(const CallICFGNode* cs) const
     {
-        return csToCallSiteRetPtsMap[cs];
+        CallSiteToPointsToMap::const_iterator it = csToCallSiteRetPtsMap.find(cs);
+        assert(it!=csToCallSiteRetPtsMap.end() && "callsite pts not collected??");
+        return it->second;
     }
     /// Whether the object node is a non-local object
     /// including global, heap, and stack variable in recursions
@@ -264,8 +280,11 @@ private:
     /// Get all the objects in callee's modref escaped via global objects (the chain pts of globals)
     void getEscapObjviaGlobals(NodeBS& globs, const NodeBS& pts);
 
-    /// Get reverse topo call graph scc
-    void getCallGraphSCCRevTopoOrder(WorkList& worklist);
+    /// Get call graph SCCs by level: callees are at lower levels than their callers
+    void getCallGraphSCCLevels(std::vector<std::vector<NodeID>>& levels);
+
+    /// Merge the side effects found by a thread
+    void mergeModRefDelta(ModRefDelta& delta);
 
 protected:
     MRGenerator(BVDataPTAImpl* p, bool ptrOnly);
@@ -274,9 +293,11 @@ protected:
     MRSet memRegSet;
     /// Map a condition pts to its rep conditional pts (super set points-to)
     PtsToRepPtsSetMap cptsToRepCPtsMap;
+    /// Regions hashed on their rep pts and on every cpts they were created for
+    PtsToMRMap ptsToMRMap;
 
     /// Generate a memory region and put in into functions which use it
-    void createMR(const SVFFunction* fun, const NodeBS& cpts);
+    const MemRegion* createMR(const SVFFunction* fun, const NodeBS& cpts);
 
     /// Collect all global variables for later escape analysis
     void collectGlobals();
@@ -325,11 +346,14 @@ protected:
         aliasMRs.insert(mr);
     }
 
-    /// Mod-Ref analysis for callsite invoking this callGraphNode
-    virtual void modRefAnalysis(PTACallGraphNode* callGraphNode, WorkList& worklist);
+    /// Mod-Ref analysis for callsites invoking the call graph SCC of rep
+    virtual void modRefAnalysis(NodeID rep, ModRefDelta& delta);
+
+    /// Mod-Ref of the callsites of a call graph edge from those of callee
+    bool handleCallEdgeModRef(const PTACallGraphEdge* edge, const SVFFunction* callee, ModRefDelta& delta);
 
     /// Get Mod-Ref of a callee function
-    virtual bool handleCallsiteModRef(NodeBS& mod, NodeBS& ref, const CallICFGNode* cs, const SVFFunction* fun);
+    virtual bool handleCallsiteModRef(const CallICFGNode* cs, const SVFFunction* callee, ModRefDelta& delta);
 
 
     /// Add cpts to store/load
@@ -375,10 +399,20 @@ protected:
     void addRefSideEffectOfFunction(const SVFFunction* fun, const NodeBS& refs);
     /// Add indirect def an memory object in the function
     void addModSideEffectOfFunction(const SVFFunction* fun, const NodeBS& mods);
+    /// Add indirect uses an memory object in the function (found by a thread)
+    void addRefSideEffectOfFunction(const SVFFunction* fun, const NodeBS& refs, ModRefDelta& delta);
+    /// Add indirect def an memory object in the function (found by a thread)
+    void addModSideEffectOfFunction(const SVFFunction* fun, const NodeBS& mods, ModRefDelta& delta);
     /// Add indirect uses an memory object in the function
-    bool addRefSideEffectOfCallSite(const CallICFGNode* cs, const NodeBS& refs);
+    bool addRefSideEffectOfCallSite(const CallICFGNode* cs, const NodeBS& refs, ModRefDelta& delta);
     /// Add indirect def an memory object in the function
-    bool addModSideEffectOfCallSite(const CallICFGNode* cs, const NodeBS& mods);
+    bool addModSideEffectOfCallSite(const CallICFGNode* cs, const NodeBS& mods, ModRefDelta& delta);
+
+    /// Get indirect refs/mods of a function, including those found by a thread
+    //@{
+    NodeBS getRefSideEffectOfFunction(const SVFFunction* fun, const ModRefDelta& delta) const;
+    NodeBS getModSideEffectOfFunction(const SVFFunction* fun, const ModRefDelta& delta) const;
+    //@}
 
     /// Get indirect refs of a function
     inline const NodeBS& getRefSideEffectOfFunction(const SVFFunction* fun)
@@ -427,6 +461,14 @@ public:
     /// Start generating memory regions
     virtual void generateMRs();
 
+    /// Cache the memory regions in a file (MemRegionReadWrite.cpp)
+    //@{
+    void writeToFile(const std::string& filename);
+    bool readFromFile(const std::string& filename);
+    /// Hash of the module, points-to results and options the regions depend on
+    std::string getCacheKey() const;
+    //@}
+
     /// Get the function which SVFIR Edge located
     const SVFFunction* getFunction(const PAGEdge* pagEdge) const
     {
@@ -440,6 +482,14 @@ public:
     {
         return funToMRsMap[fun];
     }
+    inline bool hasLoadMRSet(const LoadStmt* load) const
+    {
+        return loadsToMRsMap.find(load)!=loadsToMRsMap.end();
+    }
+    inline bool hasStoreMRSet(const StoreStmt* store) const
+    {
+        return storesToMRsMap.find(store)!=storesToMRsMap.end();
+    }
     inline MRSet& getLoadMRSet(const LoadStmt* load)
     {
         return loadsToMRsMap[load];
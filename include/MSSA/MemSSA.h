@@ -85,6 +85,7 @@ public:
     /// For phi insertion
     //@{
     typedef std::vector<const BasicBlock*> BBList;
+    typedef Set<const BasicBlock*> BBSet;
     typedef Map<const BasicBlock*, MRSet> BBToMRSetMap;
     typedef Map<const MemRegion*, BBList> MemRegToBBsMap;
     //@}
@@ -122,6 +123,8 @@ protected:
     virtual void createMUCHI(const SVFFunction& fun);
     /// Insert phi for candidate regions in a fucntion
     virtual void insertPHI(const SVFFunction& fun);
+    /// Collect blocks from which one of useBBs is reachable, other than those in knownLiveIns
+    void collectLiveInBBs(const BBList& useBBs, const BBSet& knownLiveIns, BBSet& liveIns) const;
     /// SSA rename for a function
     virtual void SSARename(const SVFFunction& fun);
     /// SSA rename for a basic block
@@ -148,11 +151,16 @@ private:
     MemRegToBBsMap reg2BBMap;
     /// Collect memory regions whose definition killed
     MRSet varKills;
+    /// Maps memory region to the basic blocks using it (for pruned SSA)
+    MemRegToBBsMap reg2UseBBMap;
     //@}
 
     /// Release the memory
     void destroy();
 
+    /// Worker sharing the memory regions of mssa (see createWorker)
+    MemSSA(const MemSSA& mssa);
+
     /// Get a new SSA name of a memory region
     MRVer* newSSAName(const MemRegion* mr, MSSADEF* def);
 
@@ -166,10 +174,11 @@ private:
 
     /// Collect region uses and region defs according to mus/chis, in order to insert phis
     //@{
-    inline void collectRegUses(const MemRegion* mr)
+    inline void collectRegUses(const BasicBlock* bb, const MemRegion* mr)
     {
         if (0 == varKills.count(mr))
             usedRegs.insert(mr);
+        reg2UseBBMap[mr].push_back(bb);
     }
     inline void collectRegDefs(const BasicBlock* bb, const MemRegion* mr)
     {
@@ -209,26 +218,26 @@ private:
     {
         LOADMU* mu = new LOADMU(bb,load, mr);
         load2MuSetMap[load].insert(mu);
-        collectRegUses(mr);
+        collectRegUses(bb,mr);
     }
     inline void AddStoreCHI(const BasicBlock* bb, const StoreStmt* store, const MemRegion* mr)
     {
         STORECHI* chi = new STORECHI(bb,store, mr);
         store2ChiSetMap[store].insert(chi);
-        collectRegUses(mr);
+        collectRegUses(bb,mr);
         collectRegDefs(bb,mr);
     }
     inline void AddCallSiteMU(const CallICFGNode* cs, const MemRegion* mr)
     {
         CALLMU* mu = new CALLMU(cs, mr);
         callsiteToMuSetMap[cs].insert(mu);
-        collectRegUses(mr);
+        collectRegUses(mu->getBasicBlock(),mr);
     }
     inline void AddCallSiteCHI(const CallICFGNode* cs, const MemRegion* mr)
     {
         CALLCHI* chi = new CALLCHI(cs, mr);
         callsiteToChiSetMap[cs].insert(chi);
-        collectRegUses(mr);
+        collectRegUses(chi->getBasicBlock(),mr);
         collectRegDefs(chi->getBasicBlock(),mr);
     }
     inline void AddMSSAPHI(const BasicBlock* bb, const MemRegion* mr)
@@ -324,6 +333,15 @@ public:
     /// We start from here
     virtual void buildMemSSA(const SVFFunction& fun,DominanceFrontier*, DominatorTree*);
 
+    /// Building the memory SSA of functions on other threads
+    //@{
+    /// Create a worker sharing our memory regions, into which the memory SSA
+    /// of some functions can be built independently of other workers.
+    MemSSA* createWorker() const;
+    /// Move the memory SSA built by worker into ours, and delete worker.
+    void mergeWorker(MemSSA* worker);
+    //@}
+
     /// Perform statistics
     void performStat();
 
@@ -66,7 +66,7 @@ public:
     typedef SVFG::SVFGEdgeSetTy SVFGEdgeSet;
 
     /// Constructor
-    SVFGBuilder(bool _SVFGWithIndCall = false): svfg(nullptr), SVFGWithIndCall(_SVFGWithIndCall) {}
+    SVFGBuilder(bool _SVFGWithIndCall = false, bool _lazy = false): svfg(nullptr), SVFGWithIndCall(_SVFGWithIndCall), lazy(_lazy) {}
 
     /// Destructor
     virtual ~SVFGBuilder() {}
@@ -117,6 +117,8 @@ protected:
     SVFG* svfg;
     /// SVFG with precomputed indirect call edges
     bool SVFGWithIndCall;
+    /// Build a plain (non-optimised) SVFG on demand (see SVFG::expandFunction)
+    bool lazy;
 };
 
 } // End namespace SVF
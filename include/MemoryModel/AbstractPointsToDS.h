@@ -210,6 +210,12 @@ public:
     virtual bool updateATVPts(const Key& srcVar, LocID dstLoc, const Key& dstVar) = 0;
     ///@}
 
+    /// Union (IN[loc:var], pts) and (OUT[loc:var], pts) directly, e.g. when restoring a checkpoint.
+    ///@{
+    virtual bool unionDFInPts(LocID loc, const Key& var, const DataSet& pts) = 0;
+    virtual bool unionDFOutPts(LocID loc, const Key& var, const DataSet& pts) = 0;
+    ///@}
+
     /// Methods to support type inquiry through isa, cast, and dyn_cast:
     ///@{
     static inline bool classof(const DFPTData<Key, KeySet, Data, DataSet> *)
@@ -484,6 +484,16 @@ public:
         return (this->unionPts(this->getDFOutPtsSet(dstLoc, dstVar), this->getPts(srcVar)));
     }
 
+    virtual inline bool unionDFInPts(LocID loc, const Key& var, const DataSet& pts) override
+    {
+        return this->unionPts(getDFInPtsSet(loc, var), pts);
+    }
+
+    virtual inline bool unionDFOutPts(LocID loc, const Key& var, const DataSet& pts) override
+    {
+        return this->unionPts(getDFOutPtsSet(loc, var), pts);
+    }
+
     virtual inline void clearAllDFOutUpdatedVar(LocID) override
     {
     }
@@ -768,6 +778,26 @@ public:
         return false;
     }
 
+    virtual inline bool unionDFInPts(LocID loc, const Key& var, const DataSet& pts) override
+    {
+        if (BaseMutDFPTData::unionDFInPts(loc, var, pts))
+        {
+            setVarDFInSetUpdated(loc, var);
+            return true;
+        }
+        return false;
+    }
+
+    virtual inline bool unionDFOutPts(LocID loc, const Key& var, const DataSet& pts) override
+    {
+        if (BaseMutDFPTData::unionDFOutPts(loc, var, pts))
+        {
+            setVarDFOutSetUpdated(loc, var);
+            return true;
+        }
+        return false;
+    }
+
     virtual inline void clearAllDFOutUpdatedVar(LocID loc) override
     {
         if (this->hasDFOutSet(loc))
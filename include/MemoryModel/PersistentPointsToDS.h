@@ -488,6 +488,18 @@ public:
         return unionPtsThroughIds(getDFOutPtIdRef(dstLoc, dstVar), persPTData.ptsMap[srcVar]);
     }
 
+    virtual bool unionDFInPts(LocID loc, const Key& var, const DataSet& pts) override
+    {
+        PointsToID srcId = ptCache.emplacePts(pts);
+        return unionPtsThroughIds(getDFInPtIdRef(loc, var), srcId);
+    }
+
+    virtual bool unionDFOutPts(LocID loc, const Key& var, const DataSet& pts) override
+    {
+        PointsToID srcId = ptCache.emplacePts(pts);
+        return unionPtsThroughIds(getDFOutPtIdRef(loc, var), srcId);
+    }
+
     virtual Map<DataSet, unsigned> getAllPts(bool liveOnly) const override
     {
         Map<DataSet, unsigned> allPts = persPTData.getAllPts(liveOnly);
@@ -687,6 +699,28 @@ public:
         return false;
     }
 
+    virtual inline bool unionDFInPts(LocID loc, const Key& var, const DataSet& pts) override
+    {
+        if (BasePersDFPTData::unionDFInPts(loc, var, pts))
+        {
+            setVarDFInSetUpdated(loc, var);
+            return true;
+        }
+
+        return false;
+    }
+
+    virtual inline bool unionDFOutPts(LocID loc, const Key& var, const DataSet& pts) override
+    {
+        if (BasePersDFPTData::unionDFOutPts(loc, var, pts))
+        {
+            setVarDFOutSetUpdated(loc, var);
+            return true;
+        }
+
+        return false;
+    }
+
     virtual inline void clearAllDFOutUpdatedVar(LocID loc) override
     {
         if (this->hasDFOutSet(loc))
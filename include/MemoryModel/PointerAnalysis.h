@@ -235,6 +235,17 @@ public:
     /// Compute points-to results on-demand, overridden by derived classes
     virtual void computeDDAPts(NodeID) {}
 
+    /// Write the result of an on-demand query, and merge a result written by
+    /// another instance of the analysis; overridden by derived classes
+    //@{
+    virtual void writeDDAPts(NodeID, std::ostream&) {}
+    virtual void readDDAPts(std::istream&) {}
+    //@}
+
+    /// Add indirect calls resolved before (e.g., by an earlier run) to an
+    /// on-demand analysis, overridden by derived classes
+    virtual void updateDDACallGraph(const CallEdgeMap&) {}
+
     /// Interface exposed to users of our pointer analysis, given Value infos
     virtual AliasResult alias(const Value* V1,
                               const Value* V2) = 0;
@@ -0,0 +1,165 @@
+//===- CallStrCxt.h -- Interned call string contexts ------------------------//
+//
+//                     SVF: Static Value-Flow Analysis
+//
+// Copyright (C) <2013-2017>  <Yulei Sui>
+//
+
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+//
+//===----------------------------------------------------------------------===//
+
+/*
+ * CallStrCxt.h
+ *
+ * A call string context (a sequence of call site IDs) is interned in a trie
+ * shared by all contexts and represented by the 32-bit ID of its trie node,
+ * so that copying, comparing for equality and hashing a context is O(1).
+ */
+
+#ifndef CALLSTRCXT_H_
+#define CALLSTRCXT_H_
+
+#include "Util/SVFBasicTypes.h"
+#include <deque>
+
+namespace SVF
+{
+
+/*!
+ * Call string context with the interface of a vector of call site IDs.
+ * Contexts are shared by all analyses and the table is not thread-safe.
+ */
+class CallStrCxt
+{
+public:
+    typedef std::vector<u32_t> CallSites;
+    typedef CallSites::const_iterator const_iterator;
+
+    /// Empty context
+    CallStrCxt() : id(0) {}
+
+    /// Trie node of this context, 0 is the empty context
+    inline u32_t getId() const
+    {
+        return id;
+    }
+
+    /// Call sites of this context, the oldest one first
+    inline const CallSites& getCallSites() const
+    {
+        return getTable().callSites[id];
+    }
+
+    /// Vector interface
+    //@{
+    inline bool empty() const
+    {
+        return id == 0;
+    }
+    inline u32_t size() const
+    {
+        return getCallSites().size();
+    }
+    inline u32_t back() const
+    {
+        assert(!empty() && "empty context!");
+        return getTable().labels[id];
+    }
+    inline u32_t operator[](u32_t index) const
+    {
+        assert(index < size());
+        return getCallSites()[index];
+    }
+    inline const_iterator begin() const
+    {
+        return getCallSites().begin();
+    }
+    inline const_iterator end() const
+    {
+        return getCallSites().end();
+    }
+    inline void push_back(u32_t cs)
+    {
+        id = getTable().getChild(id, cs);
+    }
+    inline void pop_back()
+    {
+        assert(!empty() && "empty context!");
+        id = getTable().parents[id];
+    }
+    inline void clear()
+    {
+        id = 0;
+    }
+    //@}
+
+    /// Remove the oldest call site
+    void pop_front();
+
+    /// Contexts are ordered lexicographically by their call sites as before
+    //@{
+    inline bool operator==(const CallStrCxt& rhs) const
+    {
+        return id == rhs.id;
+    }
+    inline bool operator!=(const CallStrCxt& rhs) const
+    {
+        return id != rhs.id;
+    }
+    inline bool operator<(const CallStrCxt& rhs) const
+    {
+        return id != rhs.id && getCallSites() < rhs.getCallSites();
+    }
+    //@}
+
+    /// Number of contexts interned so far
+    static inline u32_t getNumOfCxts()
+    {
+        return getTable().parents.size();
+    }
+
+private:
+    /// Trie of contexts, node i being context i. Its call sites are kept along
+    /// for iteration and ordering, in a deque so that they never move.
+    struct Table
+    {
+        std::vector<u32_t> parents;
+        std::vector<u32_t> labels;
+        std::deque<CallSites> callSites;
+        Map<std::pair<u32_t, u32_t>, u32_t> children;
+
+        Table() : parents(1, 0), labels(1, 0), callSites(1) {}
+
+        u32_t getChild(u32_t parent, u32_t cs);
+    };
+
+    static Table& getTable();
+
+    u32_t id;
+};
+
+} // End namespace SVF
+
+/// Specialise hash for CallStrCxt.
+template <>
+struct std::hash<SVF::CallStrCxt>
+{
+    size_t operator()(const SVF::CallStrCxt& cxt) const
+    {
+        return cxt.getId();
+    }
+};
+
+#endif /* CALLSTRCXT_H_ */
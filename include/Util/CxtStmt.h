@@ -31,6 +31,7 @@
 #define INCLUDE_UTIL_CXTSTMT_H_
 
 #include "Util/BasicTypes.h"
+#include "Util/CallStrCxt.h"
 
 namespace SVF
 {
@@ -31,6 +31,7 @@
 #define DPITEM_H_
 
 #include "MemoryModel/ConditionalPT.h"
+#include "Util/CallStrCxt.h"
 #include <algorithm>    // std::sort
 
 namespace SVF
@@ -71,7 +72,7 @@ public:
         return *this;
     }
     /// Destructor
-    virtual ~DPItem()
+    ~DPItem()
     {
     }
     inline NodeID getCurNodeID() const
@@ -83,11 +84,11 @@ public:
         cur = c;
     }
     /// set max step budge per query
-    static inline void setMaxBudget(u32_t max)
+    static inline void setMaxBudget(u64_t max)
     {
         maximumBudget = max;
     }
-    static inline u32_t getMaxBudget()
+    static inline u64_t getMaxBudget()
     {
         return maximumBudget;
     }
@@ -146,7 +147,7 @@ public:
     {
     }
     /// Destructor
-    virtual ~StmtDPItem()
+    ~StmtDPItem()
     {
     }
     /// Get context
@@ -228,7 +229,7 @@ public:
         return *this;
     }
     /// Destructor
-    virtual ~ContextCond()
+    ~ContextCond()
     {
     }
     /// Get context
@@ -276,7 +277,7 @@ public:
         return maximumPathLen;
     }
     /// Push context
-    inline virtual bool pushContext(NodeID ctx)
+    inline bool pushContext(NodeID ctx)
     {
 
         if(context.size() < maximumCxtLen)
@@ -292,7 +293,7 @@ public:
             if(!context.empty())
             {
                 setNonConcreteCxt();
-                context.erase(context.begin());
+                context.pop_front();
                 context.push_back(ctx);
             }
             return false;
@@ -300,7 +301,7 @@ public:
     }
 
     /// Match context
-    inline virtual bool matchContext(NodeID ctx)
+    inline bool matchContext(NodeID ctx)
     {
         /// if context is empty, then it is the unbalanced parentheses match
         if(context.empty())
@@ -401,7 +402,7 @@ public:
     {
     }
     /// Destructor
-    virtual ~CxtStmtDPItem()
+    ~CxtStmtDPItem()
     {
     }
     /// Get context var
@@ -507,7 +508,7 @@ public:
         return *this;
     }
     /// Destructor
-    virtual ~CxtDPItem()
+    ~CxtDPItem()
     {
     }
 
@@ -523,7 +524,7 @@ public:
     }
 
     /// Match context
-    inline virtual bool matchContext(NodeID cxt)
+    inline bool matchContext(NodeID cxt)
     {
         return context.matchContext(cxt);
     }
@@ -73,6 +73,27 @@ public:
     /// Time limit for the Andersen's analyses.
     static const llvm::cl::opt<unsigned> AnderTimeLimit;
 
+    /// File to which FS analyses checkpoint their solver state.
+    static const llvm::cl::opt<std::string> FsCheckpoint;
+
+    /// Seconds between periodic checkpoints of FS analyses (0: only on SIGTERM).
+    static const llvm::cl::opt<unsigned> FsCheckpointInterval;
+
+    /// Checkpoint file from which FS analyses resume solving.
+    static const llvm::cl::opt<std::string> FsResume;
+
+    /// File to which FS analyses write a snapshot of their results.
+    static const llvm::cl::opt<std::string> FsSnapshot;
+
+    /// Snapshot of a previous version of the program to re-analyse from.
+    static const llvm::cl::opt<std::string> FsIncremental;
+
+    /// Only solve what FS analyses need to resolve indirect calls.
+    static const llvm::cl::opt<bool> FsQueryFunPtrs;
+
+    /// Process worklists of FS and Andersen's analyses in topological order.
+    static const llvm::cl::opt<bool> RankedWorklist;
+
     /// Number of threads for the versioning phase.
     static const llvm::cl::opt<unsigned> VersioningThreads;
 
@@ -100,6 +121,14 @@ public:
     static const llvm::cl::opt<bool> PrintCPts;
     static const llvm::cl::opt<bool> PrintQueryPts;
     static const llvm::cl::opt<bool> WPANum;
+    static const llvm::cl::opt<unsigned> DDAThreads;
+    static const llvm::cl::opt<std::string> DDACache;
+    static const llvm::cl::opt<unsigned long long> DDABudgetPool;
+    static const llvm::cl::opt<unsigned> DDATimeBudget;
+    static const llvm::cl::opt<bool> DDAServe;
+    static const llvm::cl::opt<std::string> DDAServeSocket;
+    static const llvm::cl::opt<std::string> DDAStatJSON;
+    static const llvm::cl::opt<unsigned> DDAStatTopK;
     static llvm::cl::bits<PointerAnalysis::PTATY> DDASelected;
 
     // FlowDDA.cpp
@@ -152,9 +181,14 @@ public:
     static const llvm::cl::opt<std :: string> MSSAFun;
     // static const llvm::cl::opt<string> MSSAFun;
     static const llvm::cl::opt<MemSSA::MemPartition> MemPar;
+    static const llvm::cl::opt<unsigned> MSSAThreads;
+    static const llvm::cl::opt<bool> PrunedMSSA;
+    static const llvm::cl::opt<std::string> MSSACache;
 
     // SVFG builder (SVFGBuilder.cpp)
     static const llvm::cl::opt<bool> SVFGWithIndirectCall;
+    static const llvm::cl::opt<bool> LazySVFG;
+    static const llvm::cl::opt<unsigned> SVFGThreads;
     static const llvm::cl::opt<bool> SingleVFG;
     static llvm::cl::opt<bool> OPTSVFG;
 
@@ -0,0 +1,84 @@
+//===- Parallel.h -- Running independent tasks on threads --------------------//
+//
+//                     SVF: Static Value-Flow Analysis
+//
+// Copyright (C) <2013-2017>  <Yulei Sui>
+//
+
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+//
+//===----------------------------------------------------------------------===//
+
+/*
+ * Parallel.h
+ *
+ * Helpers for running independent tasks (e.g., per-function work) on a
+ * number of threads. Tasks must not touch shared state other than reading
+ * it; results are usually collected per thread and merged afterwards.
+ */
+
+#ifndef PARALLEL_H_
+#define PARALLEL_H_
+
+#include "Util/BasicTypes.h"
+#include <atomic>
+#include <thread>
+#include <vector>
+
+namespace SVF
+{
+
+namespace SVFUtil
+{
+
+/// Number of threads to use when numThreads were asked for (0 is one per core).
+inline u32_t getNumOfThreads(u32_t numThreads)
+{
+    if (numThreads != 0) return numThreads;
+    u32_t cores = std::thread::hardware_concurrency();
+    return cores == 0 ? 1 : cores;
+}
+
+/*!
+ * Call task(i, thread) for every i in [0, n) using numThreads threads, thread
+ * being the index (< numThreads) of the thread running the task. Tasks are
+ * handed out in increasing order of i; the calling thread is thread 0.
+ */
+template<typename Task>
+void parallelFor(u32_t n, u32_t numThreads, Task task)
+{
+    if (numThreads > n) numThreads = n;
+    if (numThreads <= 1)
+    {
+        for (u32_t i = 0; i < n; ++i) task(i, 0);
+        return;
+    }
+
+    std::atomic<u32_t> next(0);
+    auto worker = [&](u32_t thread)
+    {
+        for (u32_t i = next++; i < n; i = next++) task(i, thread);
+    };
+
+    std::vector<std::thread> threads;
+    for (u32_t t = 1; t < numThreads; ++t) threads.emplace_back(worker, t);
+    worker(0);
+    for (std::thread& t : threads) t.join();
+}
+
+} // End namespace SVFUtil
+
+} // End namespace SVF
+
+#endif /* PARALLEL_H_ */
@@ -154,6 +154,18 @@ typedef struct equalNodeBS
     }
 } equalNodeBS;
 
+/// Hash over all elements of a NodeBS (std::hash only looks at its size and bounds)
+typedef struct hashNodeBS
+{
+    size_t operator()(const NodeBS& pts) const
+    {
+        size_t h = pts.count();
+        for (const NodeID o : pts)
+            h ^= o + 0x9e3779b9 + (h << 6) + (h >> 2);
+        return h;
+    }
+} hashNodeBS;
+
 inline NodeBS ptsToNodeBS(const PointsTo &pts)
 {
     NodeBS nbs;
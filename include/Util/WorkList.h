@@ -43,6 +43,7 @@
 #include <vector>
 #include <deque>
 #include <set>
+#include <tuple>
 
 namespace SVF
 {
@@ -260,6 +261,110 @@ private:
     DataVector data_list;	///< work list using std::vector.
 };
 
+/**
+ * Worklist ordered by a rank given to each data: lower ranks are popped
+ * first (e.g., topological order of SCCs). Amongst data of the same rank, the
+ * one popped least recently is popped first, so nodes in a cycle take turns.
+ * Data which have not been ranked have rank 0.
+ * Elements in the list are unique as they're recorded by Set.
+ */
+template<class Data>
+class RankedWorkList
+{
+    /// (rank, last pop, data)
+    typedef std::tuple<u32_t, u64_t, Data> Key;
+    typedef std::set<Key> KeySet;
+    typedef Set<Data> DataSet;
+public:
+    RankedWorkList() : popCount(0) {}
+
+    ~RankedWorkList() {}
+
+    inline bool empty() const
+    {
+        return data_list.empty();
+    }
+
+    inline bool find(Data data) const
+    {
+        return (data_set.find(data) == data_set.end() ? false : true);
+    }
+
+    /**
+     * Push a data into the work list.
+     */
+    inline bool push(Data data)
+    {
+        if (data_set.find(data) == data_set.end())
+        {
+            data_list.insert(getKey(data));
+            data_set.insert(data);
+            return true;
+        }
+        else
+            return false;
+    }
+
+    /**
+     * Pop the data with the lowest rank from the work list.
+     */
+    inline Data pop()
+    {
+        assert(!empty() && "work list is empty");
+        Data data = std::get<2>(*data_list.begin());
+        data_list.erase(data_list.begin());
+        data_set.erase(data);
+        lastPop[data] = ++popCount;
+        return data;
+    }
+
+    /*!
+     * Clear all the data
+     */
+    inline void clear()
+    {
+        data_list.clear();
+        data_set.clear();
+    }
+
+    /// Set the rank of data, which may already be in the work list.
+    inline void setRank(Data data, u32_t rank)
+    {
+        if (find(data))
+        {
+            data_list.erase(getKey(data));
+            ranks[data] = rank;
+            data_list.insert(getKey(data));
+        }
+        else
+            ranks[data] = rank;
+    }
+
+    /// Forget all ranks, e.g., before re-ranking.
+    inline void clearRanks()
+    {
+        ranks.clear();
+        data_list.clear();
+        for (const Data& data : data_set)
+            data_list.insert(getKey(data));
+    }
+
+private:
+    inline Key getKey(Data data) const
+    {
+        typename Map<Data, u32_t>::const_iterator rit = ranks.find(data);
+        typename Map<Data, u64_t>::const_iterator pit = lastPop.find(data);
+        return Key(rit == ranks.end() ? 0 : rit->second,
+                   pit == lastPop.end() ? 0 : pit->second, data);
+    }
+
+    DataSet data_set;	///< store all data in the work list.
+    KeySet data_list;	///< work list ordered by rank and last pop.
+    Map<Data, u32_t> ranks;	///< rank of each data.
+    Map<Data, u64_t> lastPop;	///< when each data was last popped.
+    u64_t popCount;	///< number of pops so far.
+};
+
 } // End namespace SVF
 
 #endif /* WORKLIST_H_ */
@@ -0,0 +1,6 @@
+#ifndef CONFIG_H_IN
+#define CONFIG_H_IN
+
+#define PROJECT_PATH "/root/repo"
+
+#endif
@@ -69,7 +69,11 @@ public:
         numOfProcessedPhi = numOfProcessedActualParam = numOfProcessedFormalRet = 0;
         numOfProcessedMSSANode = 0;
         maxSCCSize = numOfSCC = numOfNodesInSCC = 0;
+        numOfCGUpdates = numOfNewCallEdges = maxNewCallEdges = 0;
+        numOfNewSVFGEdges = maxNewSVFGEdges = 0;
         iterationForPrintStat = OnTheFlyIterBudgetForStat;
+        lastCheckpointTime = 0;
+        demandDriven = false;
     }
 
     /// Destructor
@@ -108,6 +112,15 @@ public:
     /// Flow sensitive analysis
     virtual void analyze();
 
+    /// Solve only the backward SVFG slice which the given top-level variables
+    /// (and the function pointers of indirect calls) depend on. Must be called
+    /// before analyze; points-to sets outside the slice are incomplete.
+    inline void setQueries(const NodeBS& vars)
+    {
+        queries = vars;
+        demandDriven = true;
+    }
+
     /// Initialize analysis
     virtual void initialize();
 
@@ -138,7 +151,48 @@ public:
         return svfg;
     }
 
+    /// Checkpoint the solver state (-fs-checkpoint) and resume from it (-fs-resume).
+    /// A checkpoint can only be resumed on the same SVFIR/SVFG it was written from.
+    //@{
+    /// Write top-level and address-taken points-to sets, objects created or collapsed
+    /// while solving, resolved indirect calls, the worklist, and the iteration count.
+    virtual void writeCheckpoint(const std::string& filename);
+    /// Restore a checkpoint into a freshly initialised analysis.
+    virtual bool readCheckpoint(const std::string& filename);
+    //@}
+
+    /// Incremental re-analysis: snapshot the solved analysis (-fs-snapshot) and
+    /// re-analyse a changed program from the snapshot of a previous version of
+    /// it (-fs-incremental), solving only the SVFG nodes affected by the change.
+    //@{
+    virtual void writeSnapshot(const std::string& filename);
+    /// Restore the unaffected part of a snapshot into a freshly initialised analysis.
+    virtual bool readSnapshot(const std::string& filename);
+    //@}
+
 protected:
+    /// Solve the worklist, writing a checkpoint before a node is processed when one is due.
+    virtual void solveWorklist();
+
+    /// Checkpoint helpers
+    //@{
+    /// Install the SIGTERM handler if checkpointing is enabled. Returns whether it was installed.
+    bool startCheckpointing();
+    /// Restore the default SIGTERM handler if startCheckpointing installed ours.
+    void stopCheckpointing(bool checkpointing);
+    /// Return TRUE if SIGTERM was received or the checkpoint interval elapsed.
+    bool isCheckpointDue();
+    /// Write/read the address-taken points-to sets (data-flow IN/OUT sets here).
+    virtual void writeCheckpointATPts(std::ostream& os);
+    /// Write a worklist entry.
+    virtual void writeCheckpointWorklistNode(std::ostream& os, NodeID id);
+    /// Handle a checkpoint line starting with tag, returns false if tag is unknown.
+    virtual bool readCheckpointLine(const std::string& tag, std::istream& is);
+    /// (De)serialise a points-to set as "{ o1 o2 ... }".
+    static void writeCheckpointPts(std::ostream& os, const PointsTo& pts);
+    static PointsTo readCheckpointPts(std::istream& is);
+    //@}
+
     /// SCC detection
     virtual NodeStack& SCCDetect();
 
@@ -237,8 +291,24 @@ protected:
     virtual void updateConnectedNodes(const SVFGEdgeSetTy& edges);
     //@}
 
+    /// Demand-driven solving
+    //@{
+    /// Compute the slice to solve for the queries.
+    void initQuerySlice();
+    /// Add node and what it depends on to the slice, recording the added nodes.
+    void extendQuerySlice(NodeID node, NodeBS& newNodes);
+    /// Only nodes in the slice are solved in demand-driven mode.
+    virtual inline void pushIntoWorklist(NodeID id)
+    {
+        if (!demandDriven || querySlice.test(id))
+            WPASVFGFSSolver::pushIntoWorklist(id);
+    }
+    //@}
+
     /// Return TRUE if this is a strong update STORE statement.
     bool isStrongUpdate(const SVFGNode* node, NodeID& singleton);
+    /// Return TRUE if obj can be strongly updated (with the current call graph).
+    bool isStrongUpdateObj(NodeID obj);
 
     /// Fills may/noAliases for the location/pointer pairs in cmp.
     virtual void countAliases(Set<std::pair<NodeID, NodeID>> cmp, unsigned *mayAliases, unsigned *noAliases);
@@ -298,6 +368,12 @@ protected:
     u32_t numOfSCC;
     u32_t numOfNodesInSCC;
 
+    u32_t numOfCGUpdates;	///< Number of call graph updates which found new edges
+    u32_t numOfNewCallEdges;	///< Number of (call site, callee) pairs found
+    u32_t maxNewCallEdges;	///< Largest number of pairs found by one update
+    u32_t numOfNewSVFGEdges;	///< Number of SVFG edges added for them
+    u32_t maxNewSVFGEdges;	///< Largest number of SVFG edges added by one update
+
     double solveTime;	///< time of solve.
     double sccTime;	///< time of SCC detection.
     double processTime;	///< time of processNode.
@@ -316,6 +392,21 @@ protected:
     NodeBS svfgHasSU;
     //@}
 
+    /// Strong update index. Points-to sets only grow, and objects only become
+    /// heap/array/field-insensitive/recursive, so stores and objects which
+    /// cannot be strongly updated stay that way.
+    //@{
+    NodeBS weakUpdateStores;	///< stores whose pointer points to more than one object
+    NodeBS nonSUObjs;	///< objects which can never be strongly updated
+    NodeBS suObjs;	///< objects which can be strongly updated with the current call graph
+    //@}
+
+    bool demandDriven;	///< whether only the slice of the queries is solved.
+    NodeBS queries;	///< top-level variables whose points-to sets are needed.
+    NodeBS querySlice;	///< SVFG nodes the queries depend on.
+
+    time_t lastCheckpointTime; ///< wall-clock time of the last checkpoint (or the solve start).
+
     void svfgStat();
 };
 
@@ -107,6 +107,14 @@ protected:
     /// Override since we want to assign different weights based on versioning.
     virtual void cluster(void) override;
 
+    /// Checkpoint versioned points-to sets instead of data-flow IN/OUT sets, and
+    /// version propagation nodes by object/version rather than by (dynamic) ID.
+    //@{
+    virtual void writeCheckpointATPts(std::ostream& os) override;
+    virtual void writeCheckpointWorklistNode(std::ostream& os, NodeID id) override;
+    virtual bool readCheckpointLine(const std::string& tag, std::istream& is) override;
+    //@}
+
 private:
     /// Prelabel the SVFG: set y(o) for stores and c(o) for delta nodes to a new version.
     void prelabel(void);
@@ -127,6 +135,9 @@ private:
     /// taken itself.
     void propagateVersion(const NodeID o, const Version v, const Version vp, bool time=true);
 
+    /// Returns the dummy node telling the solver to propagate o:v, creating it if needed.
+    const DummyVersionPropSVFGNode *getVersionPropNode(const NodeID o, const Version v);
+
     /// Fills in isStoreMap and isLoadMap.
     virtual void buildIsStoreLoadMaps(void);
 
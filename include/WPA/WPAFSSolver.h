@@ -68,6 +68,7 @@ protected:
     {
         /// SCC detection
         this->getSCCDetector()->find();
+        this->rankWorklistNodes(this->getSCCDetector()->topoNodeStack());
 
         /// Both rep and sub nodes need to be processed later.
         /// Collect sub nodes from SCCDetector.
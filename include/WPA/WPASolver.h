@@ -53,11 +53,13 @@ public:
     typedef SCCDetection<GraphType> SCC;
 
     typedef FIFOWorkList<NodeID> WorkList;
+    typedef RankedWorkList<NodeID> NodeRankedWorkList;
 
 protected:
 
     /// Constructor
-    WPASolver(): reanalyze(false), iterationForPrintStat(1000), _graph(nullptr), scc(nullptr), numOfIteration(0)
+    WPASolver(): reanalyze(false), iterationForPrintStat(1000), _graph(nullptr), scc(nullptr),
+        useRankedWorklist(false), numOfNodeVisits(0), numOfIteration(0)
     {
     }
     /// Destructor
@@ -114,6 +116,7 @@ protected:
         while (!isWorklistEmpty())
         {
             NodeID nodeId = popFromWorklist();
+            recordNodeVisit(nodeId);
             // Keep solving until workList is empty.
             processNode(nodeId);
             collapseFields();
@@ -154,23 +157,72 @@ protected:
     //@{
     inline NodeID popFromWorklist()
     {
+        if (useRankedWorklist)
+            return sccRepNode(rankedWorklist.pop());
         return sccRepNode(worklist.pop());
     }
 
     virtual inline void pushIntoWorklist(NodeID id)
     {
-        worklist.push(sccRepNode(id));
+        if (useRankedWorklist)
+            rankedWorklist.push(sccRepNode(id));
+        else
+            worklist.push(sccRepNode(id));
     }
     inline bool isWorklistEmpty()
     {
+        if (useRankedWorklist)
+            return rankedWorklist.empty();
         return worklist.empty();
     }
     inline bool isInWorklist(NodeID id)
     {
+        if (useRankedWorklist)
+            return rankedWorklist.find(id);
         return worklist.find(id);
     }
     //@}
 
+    /// Ranked worklist
+    //@{
+    /// Pop nodes in topological order of their SCCs rather than first in first out
+    inline void setUseRankedWorklist(bool ranked)
+    {
+        assert(isWorklistEmpty() && "switching worklists while solving?");
+        useRankedWorklist = ranked;
+    }
+    /// Rank nodes by topological order: all nodes of an SCC share the rank of
+    /// their rep node, which is its position in topoStack.
+    void rankWorklistNodes(NodeStack topoStack)
+    {
+        if (!useRankedWorklist)
+            return;
+
+        rankedWorklist.clearRanks();
+        u32_t rank = 0;
+        while (!topoStack.empty())
+        {
+            NodeID rep = topoStack.top();
+            topoStack.pop();
+            ++rank;
+            const NodeBS& subNodes = getSCCDetector()->subNodes(rep);
+            for (NodeBS::iterator it = subNodes.begin(), eit = subNodes.end(); it != eit; ++it)
+                rankedWorklist.setRank(*it, rank);
+        }
+    }
+    //@}
+
+    /// Node visits (nodes popped from the worklist and processed)
+    //@{
+    inline void recordNodeVisit(NodeID id)
+    {
+        ++numOfNodeVisits;
+        if (id >= nodeVisits.size())
+            nodeVisits.resize(id + 1, 0);
+        ++nodeVisits[id];
+    }
+    //@}
+
     /// Reanalyze if any constraint value changed
     bool reanalyze;
     /// print out statistics for i-th iteration
@@ -199,9 +251,39 @@ protected:
     /// Worklist for resolution
     WorkList worklist;
 
+    /// Worklist ordered by topological rank, used instead of worklist if useRankedWorklist
+    NodeRankedWorkList rankedWorklist;
+    bool useRankedWorklist;
+
+    /// Number of times each node, and all nodes, have been visited
+    std::vector<u32_t> nodeVisits;
+    u64_t numOfNodeVisits;
+
 public:
     /// num of iterations during constaint solving
     u32_t numOfIteration;
+
+    /// Node visits, for statistics
+    //@{
+    inline u64_t getNumOfNodeVisits() const
+    {
+        return numOfNodeVisits;
+    }
+    inline u32_t getNumOfVisitedNodes() const
+    {
+        u32_t num = 0;
+        for (u32_t visits : nodeVisits)
+            if (visits != 0) ++num;
+        return num;
+    }
+    inline u32_t getMaxNodeVisits() const
+    {
+        u32_t max = 0;
+        for (u32_t visits : nodeVisits)
+            if (visits > max) max = visits;
+        return max;
+    }
+    //@}
 };
 
 } // End namespace SVF
@@ -54,7 +54,7 @@ const CxtPtSet& ContextDDA::computeDDAPts(const CxtVar& var)
 {
 
     resetQuery();
-    LocDPItem::setMaxBudget(Options::CxtBudget);
+    LocDPItem::setMaxBudget(_client->getQueryBudget(Options::CxtBudget));
 
     NodeID id = var.get_id();
     PAGNode* node = getPAG()->getGNode(id);
@@ -65,6 +65,7 @@ const CxtPtSet& ContextDDA::computeDDAPts(const CxtVar& var)
     const CxtPtSet& cpts = findPT(dpm);
     DOTIMESTAT(ddaStat->_AnaTimePerQuery = DDAStat::getClk(true) - start);
     DOTIMESTAT(ddaStat->_TotalTimeOfQueries += ddaStat->_AnaTimePerQuery);
+    _client->addQuerySteps(ddaStat->_NumOfStep);
 
     if(isOutOfBudgetQuery() == false)
         unionPts(var,cpts);
@@ -87,6 +88,59 @@ void ContextDDA::computeDDAPts(NodeID id)
     computeDDAPts(var);
 }
 
+/*!
+ * Write the points-to of a query as <id> <out of budget> <number of targets>
+ * followed by <obj> <concrete> <context length> <call sites> for each target
+ */
+void ContextDDA::writeDDAPts(NodeID id, std::ostream& os)
+{
+    ContextCond cxt;
+    CxtVar var(cxt, id);
+    const CxtPtSet& cpts = getPts(var);
+    bool outOfBudget = isOutOfBudgetDpm(getDPIm(var, getDefSVFGNode(getPAG()->getGNode(id))));
+    os << id << " " << outOfBudget << " " << cpts.size();
+    for (CxtPtSet::iterator it = cpts.begin(), eit = cpts.end(); it != eit; ++it)
+    {
+        const ContextCond& objCxt = it->get_cond();
+        os << " " << it->get_id() << " " << objCxt.isConcreteCxt() << " " << objCxt.cxtSize();
+        for (NodeID cs : objCxt.getContexts())
+            os << " " << cs;
+    }
+    os << "\n";
+}
+
+void ContextDDA::readDDAPts(std::istream& is)
+{
+    NodeID id;
+    bool outOfBudget;
+    u32_t num;
+    is >> id >> outOfBudget >> num;
+    CxtPtSet cpts;
+    for (u32_t i = 0; i < num; ++i)
+    {
+        NodeID obj;
+        bool concrete;
+        u32_t cxtSize;
+        is >> obj >> concrete >> cxtSize;
+        ContextCond objCxt;
+        for (u32_t j = 0; j < cxtSize; ++j)
+        {
+            NodeID cs;
+            is >> cs;
+            objCxt.getContexts().push_back(cs);
+        }
+        if (!concrete)
+            objCxt.setNonConcreteCxt();
+        cpts.set(CxtVar(objCxt, obj));
+    }
+    assert(is && "DDA: malformed query result!");
+    ContextCond cxt;
+    CxtVar var(cxt, id);
+    unionPts(var, cpts);
+    if (outOfBudget)
+        addOutOfBudgetDpm(getDPIm(var, getDefSVFGNode(getPAG()->getGNode(id))));
+}
+
 /*!
  * Handle out-of-budget dpm
  */
@@ -0,0 +1,140 @@
+/*
+ * DDACache.cpp
+ *
+ * Reading and writing the results of DDA queries (-dda-cache).
+ */
+
+#include "Util/Options.h"
+#include "Util/SVFModule.h"
+#include "DDA/DDACache.h"
+#include <fstream>
+#include <sstream>
+
+using namespace SVF;
+using namespace SVFUtil;
+using namespace std;
+
+/*!
+ * The results depend on the program and on the analysis and its context and
+ * path limits. The budget is kept apart, see readFromFile.
+ */
+std::string DDACache::getCacheKey() const
+{
+    size_t h = std::hash<std::string>()(pta->getModule()->getModuleIdentifier());
+    auto combine = [&h](size_t v)
+    {
+        h ^= v + 0x9e3779b9 + (h << 6) + (h >> 2);
+    };
+
+    SVFIR* pag = pta->getPAG();
+    combine(pag->getTotalNodeNum());
+    combine(pag->getTotalEdgeNum());
+    combine(pta->getAnalysisTy());
+    combine(Options::MaxContextLen);
+    combine(Options::MaxPathLen);
+
+    std::stringstream ss;
+    ss << std::hex << h;
+    return ss.str();
+}
+
+u64_t DDACache::getBudget() const
+{
+    if (pta->getAnalysisTy() == PointerAnalysis::Cxt_DDA)
+        return Options::CxtBudget;
+    return Options::FlowBudget;
+}
+
+bool DDACache::readFromFile(const std::string& filename)
+{
+    ifstream F(filename.c_str());
+    if (!F.is_open())
+        return false;
+
+    string line;
+    getline(F, line);
+    istringstream header(line);
+    string magic, key;
+    u64_t budget = 0;
+    header >> magic >> key >> budget;
+    if (magic != "dda-cache" || key != getCacheKey())
+    {
+        outs() << "DDA results in '" << filename << "' are out of date, recomputing them\n";
+        return false;
+    }
+
+    outs() << "Loading DDA results from '" << filename << "'...\n";
+
+    SVFIR* pag = pta->getPAG();
+    while (getline(F, line))
+    {
+        istringstream ss(line);
+        string tag;
+        ss >> tag;
+        if (tag == "query")
+        {
+            NodeID id;
+            bool outOfBudget;
+            ss >> id >> outOfBudget;
+            if (outOfBudget && getBudget() > budget)
+                continue;
+            queryToResult[id] = line.substr(tag.size() + 1);
+        }
+        else if (tag == "call")
+        {
+            NodeID csId, funObj;
+            ss >> csId >> funObj;
+            const CallICFGNode* cs = SVFUtil::cast<CallICFGNode>(pag->getICFG()->getICFGNode(csId));
+            const MemObj* obj = pag->getObject(funObj);
+            assert(obj->isFunction() && "DDA cache: callee is not a function!");
+            const Function* callee = SVFUtil::cast<Function>(obj->getValue());
+            callEdges[cs].insert(getDefFunForMultipleModule(callee));
+        }
+        else if (!tag.empty())
+            assert(false && "DDA cache: unknown entry!");
+    }
+
+    return true;
+}
+
+/*!
+ * Merge the cached points-to of query id into the analysis
+ */
+void DDACache::answerQuery(NodeID id) const
+{
+    Map<NodeID, std::string>::const_iterator it = queryToResult.find(id);
+    assert(it != queryToResult.end() && "DDA cache: query not cached!");
+    istringstream ss(it->second);
+    pta->readDDAPts(ss);
+}
+
+void DDACache::writeToFile(const std::string& filename, const std::vector<NodeID>& queries) const
+{
+    outs() << "Writing DDA results to '" << filename << "'...";
+    std::fstream f(filename.c_str(), std::ios_base::out);
+    if (!f.good())
+    {
+        outs() << "  error opening file for writing!\n";
+        return;
+    }
+
+    f << "dda-cache " << getCacheKey() << " " << getBudget() << "\n";
+    for (NodeID id : queries)
+    {
+        f << "query ";
+        pta->writeDDAPts(id, f);
+    }
+
+    SVFIR* pag = pta->getPAG();
+    for (const CallEdgeMap::value_type& csCallees : pta->getIndCallMap())
+    {
+        for (const SVFFunction* callee : csCallees.second)
+            f << "call " << csCallees.first->getId() << " " << pag->getObjectNode(callee->getLLVMFun()) << "\n";
+    }
+
+    f.close();
+    if (f.good())
+        outs() << "\n";
+    else
+        outs() << "  error writing file!\n";
+}
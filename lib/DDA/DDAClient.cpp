@@ -14,9 +14,14 @@
 #include "SVF-FE/CPPUtil.h"
 
 #include "DDA/DDAClient.h"
+#include "DDA/DDACache.h"
 #include "DDA/FlowDDA.h"
+#include "Util/Parallel.h"
 #include <iostream>
 #include <iomanip>	// for std::setw
+#include <sstream>
+#include <sys/wait.h>
+#include <unistd.h>
 
 using namespace SVF;
 using namespace SVFUtil;
@@ -33,27 +38,174 @@ void DDAClient::answerQueries(PointerAnalysis* pta)
 
     collectCandidateQueries(pta->getPAG());
 
-    u32_t count = 0;
-    for (OrderedNodeSet::iterator nIter = candidateQueries.begin();
-            nIter != candidateQueries.end(); ++nIter,++count)
+    budgetPool = Options::DDABudgetPool;
+    budgetUsed = 0;
+    startTime = DDAStat::getClk(true);
+
+    /// Queries answered by an earlier run (-dda-cache) are merged rather than computed
+    DDACache cache(pta);
+    bool cached = !Options::DDACache.empty() && cache.readFromFile(Options::DDACache);
+    if (cached)
+        pta->updateDDACallGraph(cache.getCallEdges());
+
+    std::vector<NodeID> queries;
+    for (NodeID id : candidateQueries)
+    {
+        if (pta->getPAG()->isValidTopLevelPtr(pta->getPAG()->getGNode(id)))
+            queries.push_back(id);
+    }
+
+    u32_t numOfWorkers = getNumOfThreads(Options::DDAThreads);
+    if (numOfWorkers > 1)
     {
-        PAGNode* node = pta->getPAG()->getGNode(*nIter);
-        if(pta->getPAG()->isValidTopLevelPtr(node))
+        std::vector<NodeID> uncached;
+        for (NodeID id : queries)
         {
-            DBOUT(DGENERAL,outs() << "\n@@Computing PointsTo for :" << node->getId() <<
-                  " [" << count + 1<< "/" << candidateQueries.size() << "]" << " \n");
-            DBOUT(DDDA,outs() << "\n@@Computing PointsTo for :" << node->getId() <<
-                  " [" << count + 1<< "/" << candidateQueries.size() << "]" << " \n");
-            setCurrentQueryPtr(node->getId());
-            pta->computeDDAPts(node->getId());
+            if (cached && cache.hasQuery(id))
+                cache.answerQuery(id);
+            else
+                uncached.push_back(id);
         }
+        answerQueriesInWorkers(pta, uncached, numOfWorkers);
     }
+    else
+    {
+        u32_t pending = queries.size();
+        if (cached)
+        {
+            for (NodeID id : queries)
+            {
+                if (cache.hasQuery(id))
+                    pending--;
+            }
+        }
+
+        u32_t count = 0;
+        for (OrderedNodeSet::iterator nIter = candidateQueries.begin();
+                nIter != candidateQueries.end(); ++nIter,++count)
+        {
+            PAGNode* node = pta->getPAG()->getGNode(*nIter);
+            if(pta->getPAG()->isValidTopLevelPtr(node))
+            {
+                if (cached && cache.hasQuery(node->getId()))
+                {
+                    cache.answerQuery(node->getId());
+                    continue;
+                }
+                DBOUT(DGENERAL,outs() << "\n@@Computing PointsTo for :" << node->getId() <<
+                      " [" << count + 1<< "/" << candidateQueries.size() << "]" << " \n");
+                DBOUT(DDDA,outs() << "\n@@Computing PointsTo for :" << node->getId() <<
+                      " [" << count + 1<< "/" << candidateQueries.size() << "]" << " \n");
+                computeQuery(pta, node->getId(), pending--);
+            }
+        }
+    }
+
+    queryBudget = 0;
+
+    if (!Options::DDACache.empty())
+        cache.writeToFile(Options::DDACache, queries);
 
     vmrss = vmsize = 0;
     SVFUtil::getMemoryUsageKB(&vmrss, &vmsize);
     stat->setMemUsageAfter(vmrss, vmsize);
 }
 
+/*!
+ * Without -dda-budget-pool and -dda-time-budget every query gets the fixed
+ * budget of the analysis. With a pool, every query gets an equal share of the
+ * steps left, so that what cheap queries do not use goes to the later ones.
+ * Once the time budget is used up, queries get a budget of one step, i.e. the
+ * conservative answer the analysis falls back to when out of budget.
+ */
+void DDAClient::computeQuery(PointerAnalysis* pta, NodeID id, u32_t pendingQueries)
+{
+    DDAStat* stat = static_cast<DDAStat*>(pta->getStat());
+    if (Options::DDATimeBudget != 0 &&
+            (DDAStat::getClk(true) - startTime) / TIMEINTERVAL >= Options::DDATimeBudget)
+    {
+        queryBudget = 1;
+        stat->_NumOfTimedOutQueries++;
+    }
+    else if (budgetPool != 0)
+    {
+        u64_t left = budgetPool > budgetUsed ? budgetPool - budgetUsed : 0;
+        queryBudget = std::max<u64_t>(left / pendingQueries, 1);
+    }
+
+    if (queryBudget != 0)
+        stat->addQueryBudget(queryBudget);
+
+    setCurrentQueryPtr(id);
+    pta->computeDDAPts(id);
+}
+
+/*!
+ * Queries are independent, so they are shared out round-robin among forked
+ * copies of the (initialised) analysis, which share its SVFG and pre-analysis
+ * copy-on-write. Each worker answers its queries in order and sends back their
+ * points-to, merged here. Results only depend on the number of workers, not on
+ * scheduling; per-query statistics stay in the workers.
+ */
+void DDAClient::answerQueriesInWorkers(PointerAnalysis* pta, const std::vector<NodeID>& queries, u32_t numOfWorkers)
+{
+    std::vector<pid_t> workers;
+    std::vector<int> results;
+    outs().flush();
+    for (u32_t w = 0; w < numOfWorkers; ++w)
+    {
+        int fds[2];
+        if (pipe(fds) != 0)
+            assert(false && "DDA: cannot create pipe to worker!");
+        pid_t pid = fork();
+        assert(pid >= 0 && "DDA: cannot fork worker!");
+        if (pid == 0)
+        {
+            close(fds[0]);
+            budgetPool /= numOfWorkers;
+            std::stringstream ss;
+            for (u32_t i = w; i < queries.size(); i += numOfWorkers)
+            {
+                computeQuery(pta, queries[i], (queries.size() - 1 - i) / numOfWorkers + 1);
+                pta->writeDDAPts(queries[i], ss);
+            }
+            outs().flush();
+            const std::string str = ss.str();
+            for (size_t written = 0; written < str.size(); )
+            {
+                ssize_t n = write(fds[1], str.data() + written, str.size() - written);
+                if (n <= 0)
+                    _exit(1);
+                written += n;
+            }
+            close(fds[1]);
+            _exit(0);
+        }
+        close(fds[1]);
+        workers.push_back(pid);
+        results.push_back(fds[0]);
+    }
+
+    for (u32_t w = 0; w < numOfWorkers; ++w)
+    {
+        std::string str;
+        char buf[4096];
+        ssize_t n;
+        while ((n = read(results[w], buf, sizeof(buf))) > 0)
+            str.append(buf, n);
+        close(results[w]);
+
+        int status;
+        waitpid(workers[w], &status, 0);
+        if (!WIFEXITED(status) || WEXITSTATUS(status) != 0)
+            assert(false && "DDA: worker failed!");
+
+        std::istringstream ss(str);
+        while ((ss >> std::ws).peek() != EOF)
+            pta->readDDAPts(ss);
+    }
+}
+
 OrderedNodeSet& FunptrDDAClient::collectCandidateQueries(SVFIR* p)
 {
     setPAG(p);
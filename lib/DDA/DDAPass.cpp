@@ -15,6 +15,10 @@
 
 #include <sstream>
 #include <limits.h>
+#include <cstring>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <unistd.h>
 
 using namespace SVF;
 using namespace SVFUtil;
@@ -123,6 +127,12 @@ void DDAPass::runPointerAnalysis(SVFModule* module, u32_t kind)
     {
         ///initialize
         _pta->initialize();
+        if (Options::DDAServe)
+        {
+            serveQueries();
+            _pta->finalize();
+            return;
+        }
         ///compute points-to
         _client->answerQueries(_pta);
         ///finalize
@@ -317,3 +327,161 @@ void DDAPass::printQueryPTS()
         _pta->dumpPts(*it,pts);
     }
 }
+
+/*!
+ * Serve requests with the analysis built once, so that the SVFG and the
+ * points-to cached by earlier requests are reused by later ones. Each request
+ * is a line and gets a one-line response ending with the time it took (ms):
+ *   pts <ptr>              -> pts <ptr> <ms>: <objs>
+ *   alias <ptr> <ptr>      -> alias <ptr> <ptr> <ms>: NoAlias|MayAlias|MustAlias
+ *   callees <call site>    -> callees <call site> <ms>: <functions>
+ *   quit
+ * Malformed requests get "error <reason>".
+ */
+void DDAPass::serveQueries()
+{
+    outs().flush();
+    if (Options::DDAServeSocket.empty())
+    {
+        serveQueries(stdin, stdout);
+        return;
+    }
+
+    const std::string& path = Options::DDAServeSocket;
+    struct sockaddr_un addr;
+    assert(path.size() < sizeof(addr.sun_path) && "socket path too long!");
+    memset(&addr, 0, sizeof(addr));
+    addr.sun_family = AF_UNIX;
+    strncpy(addr.sun_path, path.c_str(), sizeof(addr.sun_path) - 1);
+
+    int sock = socket(AF_UNIX, SOCK_STREAM, 0);
+    assert(sock >= 0 && "cannot create socket!");
+    unlink(path.c_str());
+    if (bind(sock, (struct sockaddr*)&addr, sizeof(addr)) != 0 || listen(sock, 1) != 0)
+    {
+        SVFUtil::errs() << "cannot listen on socket " << path << "\n";
+        close(sock);
+        return;
+    }
+    outs() << "Serving DDA requests on " << path << "\n";
+    outs().flush();
+
+    /// one client at a time, until one of them asks to quit
+    bool quit = false;
+    while (!quit)
+    {
+        int conn = accept(sock, nullptr, nullptr);
+        if (conn < 0)
+            break;
+        FILE* in = fdopen(conn, "r");
+        FILE* out = fdopen(dup(conn), "w");
+        quit = serveQueries(in, out);
+        fclose(out);
+        fclose(in);
+    }
+    close(sock);
+    unlink(path.c_str());
+}
+
+bool DDAPass::serveQueries(FILE* in, FILE* out)
+{
+    char* line = nullptr;
+    size_t cap = 0;
+    bool quit = false;
+    while (!quit && getline(&line, &cap, in) != -1)
+    {
+        std::string request(line);
+        while (!request.empty() && (request.back() == '\n' || request.back() == '\r'))
+            request.pop_back();
+        if (request.empty())
+            continue;
+        if (request == "quit")
+        {
+            quit = true;
+            continue;
+        }
+        std::string response = answerRequest(request);
+        fputs(response.c_str(), out);
+        fputc('\n', out);
+        fflush(out);
+    }
+    free(line);
+    return quit;
+}
+
+std::string DDAPass::answerRequest(const std::string& request)
+{
+    SVFIR* pag = _pta->getPAG();
+    std::stringstream req(request);
+    std::string kind;
+    req >> kind;
+
+    std::vector<NodeID> ids;
+    NodeID id;
+    while (req >> id)
+        ids.push_back(id);
+    if (!req.eof())
+        return "error malformed request '" + request + "'";
+
+    std::stringstream rsp;
+    double start = DDAStat::getClk(true);
+    if (kind == "pts" && ids.size() == 1)
+    {
+        if (!pag->hasGNode(ids[0]) || !pag->isValidTopLevelPtr(pag->getGNode(ids[0])))
+            return "error " + std::to_string(ids[0]) + " is not a top-level pointer";
+        _pta->computeDDAPts(ids[0]);
+        rsp << ":";
+        for (NodeID obj : _pta->getPts(ids[0]))
+            rsp << " " << obj;
+    }
+    else if (kind == "alias" && ids.size() == 2)
+    {
+        if (!pag->hasGNode(ids[0]) || !pag->hasGNode(ids[1]))
+            return "error no such pointer";
+        switch (alias(ids[0], ids[1]))
+        {
+        case AliasResult::NoAlias:
+            rsp << ": NoAlias";
+            break;
+        case AliasResult::MustAlias:
+            rsp << ": MustAlias";
+            break;
+        default:
+            rsp << ": MayAlias";
+            break;
+        }
+    }
+    else if (kind == "callees" && ids.size() == 1)
+    {
+        ICFG* icfg = pag->getICFG();
+        if (!icfg->hasICFGNode(ids[0]) || !SVFUtil::isa<CallICFGNode>(icfg->getICFGNode(ids[0])))
+            return "error " + std::to_string(ids[0]) + " is not a call site";
+        const CallICFGNode* cs = SVFUtil::cast<CallICFGNode>(icfg->getICFGNode(ids[0]));
+        rsp << ":";
+        if (!pag->isIndirectCallSites(cs))
+        {
+            if (const SVFFunction* callee = SVFUtil::getCallee(cs->getCallSite()))
+                rsp << " " << callee->getName();
+        }
+        else
+        {
+            NodeID funPtr = pag->getFunPtr(cs);
+            _pta->computeDDAPts(funPtr);
+            for (NodeID obj : _pta->getPts(funPtr))
+            {
+                const MemObj* mem = pag->getObject(obj);
+                if (mem && mem->isFunction())
+                    rsp << " " << mem->getValue()->getName().str();
+            }
+        }
+    }
+    else
+        return "error unknown request '" + request + "'";
+
+    std::stringstream head;
+    head << kind;
+    for (NodeID i : ids)
+        head << " " << i;
+    head << " " << (DDAStat::getClk(true) - start);
+    return head.str() + rsp.str();
+}
@@ -10,8 +10,11 @@
 #include "DDA/ContextDDA.h"
 #include "Graphs/SVFGStat.h"
 #include "MemoryModel/PointsTo.h"
+#include "Util/Options.h"
+#include "Util/cJSON.h"
 
 #include <iomanip>
+#include <fstream>
 
 using namespace SVF;
 using namespace SVFUtil;
@@ -62,6 +65,13 @@ void DDAStat::initDefault()
 
     _vmrssUsageBefore = _vmrssUsageAfter = 0;
     _vmsizeUsageBefore = _vmsizeUsageAfter = 0;
+
+    _NumOfTimedOutQueries = 0;
+    _LastNumOfTimedOutQueries = 0;
+    _QueryBudgeted = false;
+    _NumOfCacheLookups = _NumOfCacheHits = 0;
+    _NumOfBudgetedQueries = 0;
+    _MinQueryBudget = _MaxQueryBudget = _TotalQueryBudget = 0;
 }
 
 SVFG* DDAStat::getSVFG() const
@@ -155,6 +165,27 @@ void DDAStat::performStatPerQuery(NodeID ptr)
     _TotalNumOfStep += _NumOfStep;
     _TotalNumOfStepInCycle += _NumOfStepInCycle;
 
+    QueryStat query;
+    query.ptr = ptr;
+    query.startNode = getSVFG()->getDefSVFGNode(SVFIR::getPAG()->getGNode(ptr))->getId();
+    query.time = _AnaTimePerQuery;
+    query.steps = _NumOfStep;
+    query.svfgNodes = NumOfLoc;
+    query.dpms = _NumOfDPM;
+    query.cacheLookups = _NumOfCacheLookups;
+    query.cacheHits = _NumOfCacheHits;
+    query.outOfBudget = nullptr;
+    if (flowDDA ? flowDDA->isOutOfBudgetQuery() : contextDDA->isOutOfBudgetQuery())
+    {
+        if (_NumOfTimedOutQueries != _LastNumOfTimedOutQueries)
+            query.outOfBudget = "time-budget";
+        else if (_QueryBudgeted)
+            query.outOfBudget = "budget-pool";
+        else
+            query.outOfBudget = "step-limit";
+    }
+    queryStats.push_back(query);
+
     timeStatMap.clear();
     NumPerQueryStatMap.clear();
 
@@ -183,9 +214,125 @@ void DDAStat::performStatPerQuery(NodeID ptr)
     _NumOfMustAliases = 0;
     _NumOfInfeasiblePath = 0;
     _AnaTimeCyclePerQuery = 0;
+    _NumOfCacheLookups = 0;
+    _NumOfCacheHits = 0;
+    _QueryBudgeted = false;
+    _LastNumOfTimedOutQueries = _NumOfTimedOutQueries;
     _NumOfIndCallEdgeSolved = getPTA()->getNumOfResolvedIndCallEdge();
 }
 
+/// Nearest-rank percentile of sorted values
+template<typename T>
+static T percentile(const std::vector<T>& sorted, u32_t p)
+{
+    size_t rank = (sorted.size() * p + 99) / 100;
+    return sorted[rank == 0 ? 0 : rank - 1];
+}
+
+void DDAStat::performQueryDistributionStat()
+{
+    if (queryStats.empty())
+        return;
+
+    std::vector<double> times;
+    std::vector<u64_t> steps;
+    u64_t lookups = 0;
+    u64_t hits = 0;
+    u32_t outOfBudget = 0;
+    for (const QueryStat& query : queryStats)
+    {
+        times.push_back(query.time);
+        steps.push_back(query.steps);
+        lookups += query.cacheLookups;
+        hits += query.cacheHits;
+        if (query.outOfBudget)
+            outOfBudget++;
+    }
+    std::sort(times.begin(), times.end());
+    std::sort(steps.begin(), steps.end());
+
+    timeStatMap["QueryTimeP50"] = percentile(times, 50)/TIMEINTERVAL;
+    timeStatMap["QueryTimeP90"] = percentile(times, 90)/TIMEINTERVAL;
+    timeStatMap["QueryTimeP99"] = percentile(times, 99)/TIMEINTERVAL;
+    timeStatMap["QueryTimeMax"] = times.back()/TIMEINTERVAL;
+    PTNumStatMap["QueryStepP50"] = percentile(steps, 50);
+    PTNumStatMap["QueryStepP90"] = percentile(steps, 90);
+    PTNumStatMap["QueryStepP99"] = percentile(steps, 99);
+    PTNumStatMap["QueryStepMax"] = steps.back();
+    PTNumStatMap["OOBQueries"] = outOfBudget;
+    timeStatMap["CacheHitRate"] = lookups != 0 ? (double)hits/lookups : 0;
+}
+
+void DDAStat::printSlowestQueries()
+{
+    std::vector<const QueryStat*> slowest;
+    for (const QueryStat& query : queryStats)
+        slowest.push_back(&query);
+    std::stable_sort(slowest.begin(), slowest.end(), [](const QueryStat* a, const QueryStat* b)
+    {
+        return a->time > b->time;
+    });
+    if (slowest.size() > Options::DDAStatTopK)
+        slowest.resize(Options::DDAStatTopK);
+    if (slowest.empty())
+        return;
+
+    SVFUtil::outs() << "---------------------Slowest Queries-------------------------------\n";
+    for (const QueryStat* query : slowest)
+    {
+        SVFUtil::outs() << "Ptr " << query->ptr << " from SVFG node " << query->startNode << ": "
+                        << query->time/TIMEINTERVAL << "s, " << query->steps << " steps, "
+                        << query->svfgNodes << " SVFG nodes, " << query->dpms << " dpms, "
+                        << query->cacheHits << "/" << query->cacheLookups << " cache hits";
+        if (query->outOfBudget)
+            SVFUtil::outs() << ", out of budget (" << query->outOfBudget << ")";
+        SVFUtil::outs() << "\n";
+    }
+}
+
+/*!
+ * Write every query and the percentiles as
+ * {"queries": [{"ptr": .., "startNode": .., "time": .., ...}], "summary": {"QueryTimeP50": .., ...}}
+ * Times are in seconds.
+ */
+void DDAStat::writeQueryStatsToJSON(const std::string& filename)
+{
+    cJSON* root = cJSON_CreateObject();
+    cJSON* queries = cJSON_AddArrayToObject(root, "queries");
+    for (const QueryStat& query : queryStats)
+    {
+        cJSON* item = cJSON_CreateObject();
+        cJSON_AddNumberToObject(item, "ptr", query.ptr);
+        cJSON_AddNumberToObject(item, "startNode", query.startNode);
+        cJSON_AddNumberToObject(item, "time", query.time/TIMEINTERVAL);
+        cJSON_AddNumberToObject(item, "steps", query.steps);
+        cJSON_AddNumberToObject(item, "svfgNodes", query.svfgNodes);
+        cJSON_AddNumberToObject(item, "dpms", query.dpms);
+        cJSON_AddNumberToObject(item, "cacheLookups", query.cacheLookups);
+        cJSON_AddNumberToObject(item, "cacheHits", query.cacheHits);
+        if (query.outOfBudget)
+            cJSON_AddStringToObject(item, "outOfBudget", query.outOfBudget);
+        else
+            cJSON_AddNullToObject(item, "outOfBudget");
+        cJSON_AddItemToArray(queries, item);
+    }
+
+    cJSON* summary = cJSON_AddObjectToObject(root, "summary");
+    for (const char* name : {"QueryTimeP50", "QueryTimeP90", "QueryTimeP99", "QueryTimeMax", "CacheHitRate"})
+        cJSON_AddNumberToObject(summary, name, timeStatMap[name]);
+    for (const char* name : {"QueryStepP50", "QueryStepP90", "QueryStepP99", "QueryStepMax", "OOBQueries"})
+        cJSON_AddNumberToObject(summary, name, PTNumStatMap[name]);
+
+    char* json = cJSON_Print(root);
+    std::ofstream F(filename);
+    if (F.is_open())
+        F << json << "\n";
+    else
+        SVFUtil::writeWrnMsg("cannot write DDA query statistics to " + filename);
+    cJSON_free(json);
+    cJSON_Delete(root);
+}
+
 void DDAStat::getNumOfOOBQuery()
 {
     if (flowDDA)
@@ -246,7 +393,22 @@ void DDAStat::performStat()
     PTNumStatMap["MemoryUsageVmrss"] = _vmrssUsageAfter - _vmrssUsageBefore;
     PTNumStatMap["MemoryUsageVmsize"] = _vmsizeUsageAfter - _vmsizeUsageBefore;
 
+    /// Budgets given out by -dda-budget-pool and -dda-time-budget
+    if (_NumOfBudgetedQueries != 0)
+    {
+        PTNumStatMap["MinQueryBudget"] = _MinQueryBudget;
+        PTNumStatMap["MaxQueryBudget"] = _MaxQueryBudget;
+        timeStatMap["AvgQueryBudget"] = (double)_TotalQueryBudget/_NumOfBudgetedQueries;
+        PTNumStatMap["TimedOutQueries"] = _NumOfTimedOutQueries;
+    }
+
+    performQueryDistributionStat();
+
     printStat();
+
+    printSlowestQueries();
+    if (!Options::DDAStatJSON.empty() && !queryStats.empty())
+        writeQueryStatsToJSON(Options::DDAStatJSON);
 }
 
 void DDAStat::printStatPerQuery(NodeID ptr, const PointsTo& pts)
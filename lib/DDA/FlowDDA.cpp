@@ -21,7 +21,7 @@ using namespace SVFUtil;
 void FlowDDA::computeDDAPts(NodeID id)
 {
     resetQuery();
-    LocDPItem::setMaxBudget(Options::FlowBudget);
+    LocDPItem::setMaxBudget(_client->getQueryBudget(Options::FlowBudget));
 
     PAGNode* node = getPAG()->getGNode(id);
     LocDPItem dpm = getDPIm(node->getId(),getDefSVFGNode(node));
@@ -31,6 +31,7 @@ void FlowDDA::computeDDAPts(NodeID id)
     const PointsTo& pts = findPT(dpm);
     DOTIMESTAT(ddaStat->_AnaTimePerQuery = DDAStat::getClk(true) - start);
     DOTIMESTAT(ddaStat->_TotalTimeOfQueries += ddaStat->_AnaTimePerQuery);
+    _client->addQuerySteps(ddaStat->_NumOfStep);
 
     if(isOutOfBudgetQuery() == false)
         unionPts(node->getId(),pts);
@@ -44,6 +45,38 @@ void FlowDDA::computeDDAPts(NodeID id)
 }
 
 
+/*!
+ * Write the points-to of a query as <id> <out of budget> <number of targets> <targets>
+ */
+void FlowDDA::writeDDAPts(NodeID id, std::ostream& os)
+{
+    const PointsTo& pts = getPts(id);
+    bool outOfBudget = isOutOfBudgetDpm(getDPIm(id, getDefSVFGNode(getPAG()->getGNode(id))));
+    os << id << " " << outOfBudget << " " << pts.count();
+    for (NodeID obj : pts)
+        os << " " << obj;
+    os << "\n";
+}
+
+void FlowDDA::readDDAPts(std::istream& is)
+{
+    NodeID id;
+    bool outOfBudget;
+    u32_t num;
+    is >> id >> outOfBudget >> num;
+    PointsTo pts;
+    for (u32_t i = 0; i < num; ++i)
+    {
+        NodeID obj;
+        is >> obj;
+        pts.set(obj);
+    }
+    assert(is && "DDA: malformed query result!");
+    unionPts(id, pts);
+    if (outOfBudget)
+        addOutOfBudgetDpm(getDPIm(id, getDefSVFGNode(getPAG()->getGNode(id))));
+}
+
 /*!
  * Handle out-of-budget dpm
  */
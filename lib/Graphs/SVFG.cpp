@@ -35,6 +35,8 @@
 #include "Graphs/ICFG.h"
 #include "Util/Options.h"
 #include "MemoryModel/PointerAnalysisImpl.h"
+#include "MSSA/SVFGBuilder.h"
+#include "Util/Parallel.h"
 #include <fstream>
 #include "Util/Options.h"
 
@@ -105,7 +107,7 @@ const std::string MSSAPHISVFGNode::toString() const
     rawstr << "MSSAPHISVFGNode ID: " << getId() << " {fun: " << getFun()->getName() << "}";
     rawstr << "MR_" << getResVer()->getMR()->getMRID()
            << "V_" << getResVer()->getSSAVersion() << " = PHI(";
-    for (MemSSA::PHI::OPVers::const_iterator it = opVerBegin(), eit = opVerEnd();
+    for (OPVers::const_iterator it = opVerBegin(), eit = opVerEnd();
             it != eit; it++)
         rawstr << "MR_" << it->second->getMR()->getMRID() << "V_" << it->second->getSSAVersion() << ", ";
     rawstr << ")\n";
@@ -187,17 +189,26 @@ const std::string ThreadMHPIndSVFGEdge::toString() const
 }
 
 
-FormalOUTSVFGNode::FormalOUTSVFGNode(NodeID id, const MRVer* mrVer, const FunExitICFGNode* funExit): MRSVFGNode(id, FPOUT)
+FormalOUTSVFGNode::FormalOUTSVFGNode(NodeID id, const MRVer* mrVer, const FunExitICFGNode* funExit): MRSVFGNode(id, FPOUT, mrVer->getMR())
 {
-    cpts = mrVer->getMR()->getPointsTo();
     ver = mrVer;
     funExitNode = funExit;
 }
 
+/*!
+ * Points-to sets labelling indirect edges. They are interned so that the many
+ * edges carrying the same memory region share one copy of its points-to.
+ */
+PersistentPointsToCache<NodeBS>& IndirectSVFGEdge::getPtsCache()
+{
+    static PersistentPointsToCache<NodeBS> ptsCache;
+    return ptsCache;
+}
+
 /*!
  * Constructor
  */
-SVFG::SVFG(MemSSA* _mssa, VFGK k): VFG(_mssa->getPTA()->getPTACallGraph(),k),mssa(_mssa), pta(mssa->getPTA())
+SVFG::SVFG(MemSSA* _mssa, VFGK k, bool _lazy): VFG(_mssa->getPTA()->getPTACallGraph(),k),mssa(_mssa), pta(mssa->getPTA()), lazy(_lazy)
 {
     stat = new SVFGStat(this);
 }
@@ -229,6 +240,12 @@ void SVFG::buildSVFG()
     if (!Options::ReadSVFG.empty())
     {
         readFile(Options::ReadSVFG);
+        lazy = false;
+    }
+    else if (lazy)
+    {
+        /// Address-taken nodes and indirect edges are added by expandFunction
+        DBOUT(DGENERAL, outs() << pasMsg("\tSVFG Addr-taken Nodes Built On Demand\n"));
     }
     else
     {
@@ -321,102 +338,309 @@ void SVFG::addSVFGNodesForAddrTakenVars()
 
 /*
  * Connect def-use chains for indirect value-flow, (value-flow of address-taken variables)
+ * Intra-procedural edges only read the memory SSA, so they are collected for
+ * each function in parallel and added afterwards.
  */
 void SVFG::connectIndirectSVFGEdges()
 {
+    std::vector<std::vector<const VFGNode*>> funNodes;
+    getNodesOfFunctions(funNodes);
+    std::vector<IndirectVFEdgeList> funEdges(funNodes.size());
+    parallelFor(funNodes.size(), getNumOfThreads(Options::SVFGThreads), [&](u32_t i, u32_t)
+    {
+        for (const VFGNode* node : funNodes[i])
+            collectIntraIndirectVFEdges(node, funEdges[i]);
+    });
+    for (const IndirectVFEdgeList& edges : funEdges)
+    {
+        for (const std::tuple<NodeID, NodeID, const NodeBS*>& edge : edges)
+            addIntraIndirectVFEdge(std::get<0>(edge), std::get<1>(edge), *std::get<2>(edge));
+    }
 
     for(iterator it = begin(), eit = end(); it!=eit; ++it)
+        connectInterIndirectSVFGEdges(it->second);
+
+    connectFromGlobalToProgEntry();
+}
+
+/*
+ * Connect the indirect value-flows into a node (and out of formal-outs)
+ */
+void SVFG::connectIndirectSVFGEdges(const SVFGNode* node)
+{
+    IndirectVFEdgeList edges;
+    collectIntraIndirectVFEdges(node, edges);
+    for (const std::tuple<NodeID, NodeID, const NodeBS*>& edge : edges)
+        addIntraIndirectVFEdge(std::get<0>(edge), std::get<1>(edge), *std::get<2>(edge));
+
+    connectInterIndirectSVFGEdges(node);
+}
+
+/*
+ * Collect the intra-procedural indirect value-flows into a node, from the defs
+ * of the memory SSA versions it uses
+ */
+void SVFG::collectIntraIndirectVFEdges(const SVFGNode* node, IndirectVFEdgeList& edges) const
+{
+    NodeID nodeId = node->getId();
+    if(const LoadSVFGNode* loadNode = SVFUtil::dyn_cast<LoadSVFGNode>(node))
     {
-        NodeID nodeId = it->first;
-        const SVFGNode* node = it->second;
-        if(const LoadSVFGNode* loadNode = SVFUtil::dyn_cast<LoadSVFGNode>(node))
+        const MemSSA::LoadToMUSetMap& loadToMUs = mssa->getLoadToMUSetMap();
+        MemSSA::LoadToMUSetMap::const_iterator muSet = loadToMUs.find(SVFUtil::cast<LoadStmt>(loadNode->getPAGEdge()));
+        if (muSet == loadToMUs.end())
+            return;
+        for(MUSet::const_iterator it = muSet->second.begin(), eit = muSet->second.end(); it!=eit; ++it)
         {
-            MUSet& muSet = mssa->getMUSet(SVFUtil::cast<LoadStmt>(loadNode->getPAGEdge()));
-            for(MUSet::iterator it = muSet.begin(), eit = muSet.end(); it!=eit; ++it)
-            {
-                if(LOADMU* mu = SVFUtil::dyn_cast<LOADMU>(*it))
-                {
-                    NodeID def = getDef(mu->getMRVer());
-                    addIntraIndirectVFEdge(def,nodeId, mu->getMRVer()->getMR()->getPointsTo());
-                }
-            }
+            if(const LOADMU* mu = SVFUtil::dyn_cast<LOADMU>(*it))
+                edges.push_back(std::make_tuple(getDef(mu->getMRVer()), nodeId, &mu->getMRVer()->getMR()->getPointsTo()));
         }
-        else if(const StoreSVFGNode* storeNode = SVFUtil::dyn_cast<StoreSVFGNode>(node))
+    }
+    else if(const StoreSVFGNode* storeNode = SVFUtil::dyn_cast<StoreSVFGNode>(node))
+    {
+        const MemSSA::StoreToChiSetMap& storeToCHIs = mssa->getStoreToChiSetMap();
+        MemSSA::StoreToChiSetMap::const_iterator chiSet = storeToCHIs.find(SVFUtil::cast<StoreStmt>(storeNode->getPAGEdge()));
+        if (chiSet == storeToCHIs.end())
+            return;
+        for(CHISet::const_iterator it = chiSet->second.begin(), eit = chiSet->second.end(); it!=eit; ++it)
         {
-            CHISet& chiSet = mssa->getCHISet(SVFUtil::cast<StoreStmt>(storeNode->getPAGEdge()));
-            for(CHISet::iterator it = chiSet.begin(), eit = chiSet.end(); it!=eit; ++it)
+            if(const STORECHI* chi = SVFUtil::dyn_cast<STORECHI>(*it))
+                edges.push_back(std::make_tuple(getDef(chi->getOpVer()), nodeId, &chi->getOpVer()->getMR()->getPointsTo()));
+        }
+    }
+    else if(const FormalOUTSVFGNode* formalOut = SVFUtil::dyn_cast<FormalOUTSVFGNode>(node))
+    {
+        const MRVer* ver = formalOut->getMRVer();
+        edges.push_back(std::make_tuple(getDef(ver), nodeId, &ver->getMR()->getPointsTo()));
+    }
+    else if(const ActualINSVFGNode* actualIn = SVFUtil::dyn_cast<ActualINSVFGNode>(node))
+    {
+        const MRVer* ver = actualIn->getMRVer();
+        edges.push_back(std::make_tuple(getDef(ver), nodeId, &ver->getMR()->getPointsTo()));
+    }
+    else if(const MSSAPHISVFGNode* phiNode = SVFUtil::dyn_cast<MSSAPHISVFGNode>(node))
+    {
+        for (MSSAPHISVFGNode::OPVers::const_iterator it = phiNode->opVerBegin(), eit = phiNode->opVerEnd();
+                it != eit; it++)
+        {
+            const MRVer* op = it->second;
+            edges.push_back(std::make_tuple(getDef(op), nodeId, &op->getMR()->getPointsTo()));
+        }
+    }
+    /// There's no need to connect actual out node to its definition site in the same function.
+}
+
+/*
+ * Connect formal-ins to the actual-ins and formal-outs to the actual-outs of
+ * their direct call sites
+ */
+void SVFG::connectInterIndirectSVFGEdges(const SVFGNode* node)
+{
+    if(const FormalINSVFGNode* formalIn = SVFUtil::dyn_cast<FormalINSVFGNode>(node))
+    {
+        PTACallGraphEdge::CallInstSet callInstSet;
+        mssa->getPTA()->getPTACallGraph()->getDirCallSitesInvokingCallee(formalIn->getFun(),callInstSet);
+        for(PTACallGraphEdge::CallInstSet::iterator it = callInstSet.begin(), eit = callInstSet.end(); it!=eit; ++it)
+        {
+            const CallICFGNode* cs = *it;
+            if(!mssa->hasMU(cs))
+                continue;
+            ActualINSVFGNodeSet& actualIns = getActualINSVFGNodes(cs);
+            for(ActualINSVFGNodeSet::iterator ait = actualIns.begin(), aeit = actualIns.end(); ait!=aeit; ++ait)
             {
-                if(STORECHI* chi = SVFUtil::dyn_cast<STORECHI>(*it))
-                {
-                    NodeID def = getDef(chi->getOpVer());
-                    addIntraIndirectVFEdge(def,nodeId, chi->getOpVer()->getMR()->getPointsTo());
-                }
+                const ActualINSVFGNode* actualIn = SVFUtil::cast<ActualINSVFGNode>(getSVFGNode(*ait));
+                addInterIndirectVFCallEdge(actualIn,formalIn,getCallSiteID(cs, formalIn->getFun()));
             }
         }
-        else if(const FormalINSVFGNode* formalIn = SVFUtil::dyn_cast<FormalINSVFGNode>(node))
-        {
-            PTACallGraphEdge::CallInstSet callInstSet;
-            mssa->getPTA()->getPTACallGraph()->getDirCallSitesInvokingCallee(formalIn->getFun(),callInstSet);
-            for(PTACallGraphEdge::CallInstSet::iterator it = callInstSet.begin(), eit = callInstSet.end(); it!=eit; ++it)
+    }
+    else if(const FormalOUTSVFGNode* formalOut = SVFUtil::dyn_cast<FormalOUTSVFGNode>(node))
+    {
+        PTACallGraphEdge::CallInstSet callInstSet;
+        mssa->getPTA()->getPTACallGraph()->getDirCallSitesInvokingCallee(formalOut->getFun(),callInstSet);
+        for(PTACallGraphEdge::CallInstSet::iterator it = callInstSet.begin(), eit = callInstSet.end(); it!=eit; ++it)
+        {
+            const CallICFGNode* cs = *it;
+            if(!mssa->hasCHI(cs))
+                continue;
+            ActualOUTSVFGNodeSet& actualOuts = getActualOUTSVFGNodes(cs);
+            for(ActualOUTSVFGNodeSet::iterator ait = actualOuts.begin(), aeit = actualOuts.end(); ait!=aeit; ++ait)
             {
-                const CallICFGNode* cs = *it;
-                if(!mssa->hasMU(cs))
-                    continue;
-                ActualINSVFGNodeSet& actualIns = getActualINSVFGNodes(cs);
-                for(ActualINSVFGNodeSet::iterator ait = actualIns.begin(), aeit = actualIns.end(); ait!=aeit; ++ait)
-                {
-                    const ActualINSVFGNode* actualIn = SVFUtil::cast<ActualINSVFGNode>(getSVFGNode(*ait));
-                    addInterIndirectVFCallEdge(actualIn,formalIn,getCallSiteID(cs, formalIn->getFun()));
-                }
+                const ActualOUTSVFGNode* actualOut = SVFUtil::cast<ActualOUTSVFGNode>(getSVFGNode(*ait));
+                addInterIndirectVFRetEdge(formalOut,actualOut,getCallSiteID(cs, formalOut->getFun()));
             }
         }
-        else if(const FormalOUTSVFGNode* formalOut = SVFUtil::dyn_cast<FormalOUTSVFGNode>(node))
-        {
-            PTACallGraphEdge::CallInstSet callInstSet;
-            // const MemSSA::RETMU* retMu = formalOut->getRetMU();
-            mssa->getPTA()->getPTACallGraph()->getDirCallSitesInvokingCallee(formalOut->getFun(),callInstSet);
-            for(PTACallGraphEdge::CallInstSet::iterator it = callInstSet.begin(), eit = callInstSet.end(); it!=eit; ++it)
+    }
+}
+
+/*!
+ * Build the memory SSA of fun and add its address-taken nodes and indirect
+ * edges, including the inter-procedural ones to functions already expanded.
+ * Only does something for a lazily built SVFG.
+ */
+void SVFG::expandFunction(const SVFFunction* fun)
+{
+    if (!lazy || fun == nullptr || !expandedFuns.insert(fun).second)
+        return;
+
+    NodeID firstNewNode = totalVFGNode;
+    NodeBS nodes;
+    if (!isExtCall(fun))
+    {
+        DominatorTree dt;
+        dt.recalculate(*fun->getLLVMFun());
+        MemSSADF df;
+        df.runOnDT(dt);
+        mssa->buildMemSSA(*fun, &df, &dt);
+
+        addSVFGNodesForAddrTakenVars(fun, nodes);
+    }
+    for (NodeID id = firstNewNode; id < totalVFGNode; ++id)
+        nodes.set(id);
+
+    Set<const CallICFGNode*> callSites;
+    for (NodeID id : nodes)
+    {
+        const SVFGNode* node = getSVFGNode(id);
+        connectIndirectSVFGEdges(node);
+        if (const ActualINSVFGNode* actualIn = SVFUtil::dyn_cast<ActualINSVFGNode>(node))
+            callSites.insert(actualIn->getCallSite());
+        else if (const ActualOUTSVFGNode* actualOut = SVFUtil::dyn_cast<ActualOUTSVFGNode>(node))
+            callSites.insert(actualOut->getCallSite());
+    }
+
+    /// Formal-ins/outs of fun were connected to the callers expanded before;
+    /// now connect the call sites of fun to the callees expanded before.
+    PTACallGraph* callGraph = mssa->getPTA()->getPTACallGraph();
+    for (const CallICFGNode* cs : callSites)
+    {
+        if (!callGraph->hasCallGraphEdge(cs))
+            continue;
+        for (PTACallGraph::CallGraphEdgeSet::const_iterator it = callGraph->getCallEdgeBegin(cs),
+                eit = callGraph->getCallEdgeEnd(cs); it != eit; ++it)
+        {
+            const SVFFunction* callee = (*it)->getDstNode()->getFunction();
+            if ((*it)->getDirectCalls().count(cs) == 0 || expandedFuns.count(callee) == 0)
+                continue;
+            CallSiteID csId = getCallSiteID(cs, callee);
+            for (NodeID actualIn : getActualINSVFGNodes(cs))
             {
-                const CallICFGNode* cs = *it;
-                if(!mssa->hasCHI(cs))
-                    continue;
-                ActualOUTSVFGNodeSet& actualOuts = getActualOUTSVFGNodes(cs);
-                for(ActualOUTSVFGNodeSet::iterator ait = actualOuts.begin(), aeit = actualOuts.end(); ait!=aeit; ++ait)
-                {
-                    const ActualOUTSVFGNode* actualOut = SVFUtil::cast<ActualOUTSVFGNode>(getSVFGNode(*ait));
-                    addInterIndirectVFRetEdge(formalOut,actualOut,getCallSiteID(cs, formalOut->getFun()));
-                }
+                for (NodeID formalIn : getFormalINSVFGNodes(callee))
+                    addInterIndirectVFCallEdge(SVFUtil::cast<ActualINSVFGNode>(getSVFGNode(actualIn)),
+                                               SVFUtil::cast<FormalINSVFGNode>(getSVFGNode(formalIn)), csId);
+            }
+            for (NodeID formalOut : getFormalOUTSVFGNodes(callee))
+            {
+                for (NodeID actualOut : getActualOUTSVFGNodes(cs))
+                    addInterIndirectVFRetEdge(SVFUtil::cast<FormalOUTSVFGNode>(getSVFGNode(formalOut)),
+                                              SVFUtil::cast<ActualOUTSVFGNode>(getSVFGNode(actualOut)), csId);
             }
-            NodeID def = getDef(formalOut->getMRVer());
-            addIntraIndirectVFEdge(def,nodeId, formalOut->getMRVer()->getMR()->getPointsTo());
         }
-        else if(const ActualINSVFGNode* actualIn = SVFUtil::dyn_cast<ActualINSVFGNode>(node))
+    }
+
+    if (fun == SVFUtil::getProgEntryFunction(mssa->getPTA()->getModule()))
+        connectFromGlobalToProgEntry();
+}
+
+/*!
+ * Expand what a traversal along the edges of node may reach: its own function,
+ * plus callers of formal-ins/outs and callees of actual-ins/outs.
+ */
+void SVFG::expandNode(const SVFGNode* node)
+{
+    const SVFFunction* fun = node->getFun();
+    if (fun == nullptr)
+    {
+        /// Global initializers flow into the entry of main
+        expandFunction(SVFUtil::getProgEntryFunction(mssa->getPTA()->getModule()));
+        return;
+    }
+
+    expandFunction(fun);
+
+    PTACallGraph* callGraph = mssa->getPTA()->getPTACallGraph();
+    if (SVFUtil::isa<FormalINSVFGNode>(node) || SVFUtil::isa<FormalOUTSVFGNode>(node))
+    {
+        PTACallGraphEdge::CallInstSet callInstSet;
+        callGraph->getDirCallSitesInvokingCallee(fun, callInstSet);
+        for (const CallICFGNode* cs : callInstSet)
+            expandFunction(cs->getCaller());
+    }
+    else if (SVFUtil::isa<ActualINSVFGNode>(node) || SVFUtil::isa<ActualOUTSVFGNode>(node))
+    {
+        const CallICFGNode* cs = SVFUtil::isa<ActualINSVFGNode>(node) ?
+                                 SVFUtil::cast<ActualINSVFGNode>(node)->getCallSite() :
+                                 SVFUtil::cast<ActualOUTSVFGNode>(node)->getCallSite();
+        if (!callGraph->hasCallGraphEdge(cs))
+            return;
+        for (PTACallGraph::CallGraphEdgeSet::const_iterator it = callGraph->getCallEdgeBegin(cs),
+                eit = callGraph->getCallEdgeEnd(cs); it != eit; ++it)
         {
-            const MRVer* ver = actualIn->getMRVer();
-            NodeID def = getDef(ver);
-            addIntraIndirectVFEdge(def,nodeId, ver->getMR()->getPointsTo());
+            if ((*it)->getDirectCalls().count(cs))
+                expandFunction((*it)->getDstNode()->getFunction());
         }
-        else if(SVFUtil::isa<ActualOUTSVFGNode>(node))
+    }
+}
+
+/*!
+ * Create SVFG nodes for address-taken variables of fun (lazily built SVFG).
+ * Loads and stores with mus/chis are put in nodes to be connected.
+ */
+void SVFG::addSVFGNodesForAddrTakenVars(const SVFFunction* fun, NodeBS& nodes)
+{
+    MRGenerator* mrGen = mssa->getMRGenerator();
+    for (const BasicBlock* bb : fun->getReachableBBs())
+    {
+        if (mssa->hasPHISet(bb))
         {
-            /// There's no need to connect actual out node to its definition site in the same function.
+            for (MemSSA::PHI* phi : mssa->getPHISet(bb))
+                addIntraMSSAPHISVFGNode(pag->getICFG()->getICFGNode(&(bb->front())), phi->opVerBegin(), phi->opVerEnd(), phi->getResVer(), totalVFGNode++);
         }
-        else if(const MSSAPHISVFGNode* phiNode = SVFUtil::dyn_cast<MSSAPHISVFGNode>(node))
+
+        for (const Instruction& inst : *bb)
         {
-            for (MemSSA::PHI::OPVers::const_iterator it = phiNode->opVerBegin(), eit = phiNode->opVerEnd();
-                    it != eit; it++)
+            if (mrGen->hasSVFStmtList(&inst))
             {
-                const MRVer* op = it->second;
-                NodeID def = getDef(op);
-                addIntraIndirectVFEdge(def,nodeId, op->getMR()->getPointsTo());
+                for (const PAGEdge* edge : mrGen->getPAGEdgesFromInst(&inst))
+                {
+                    if (const LoadStmt* load = SVFUtil::dyn_cast<LoadStmt>(edge))
+                    {
+                        if (mssa->getLoadToMUSetMap().count(load))
+                            nodes.set(getStmtVFGNode(load)->getId());
+                    }
+                    else if (const StoreStmt* store = SVFUtil::dyn_cast<StoreStmt>(edge))
+                    {
+                        if (mssa->getStoreToChiSetMap().count(store) == 0)
+                            continue;
+                        const StmtSVFGNode* sNode = getStmtVFGNode(store);
+                        for (CHI* chi : mssa->getCHISet(store))
+                            setDef(chi->getResVer(), sNode);
+                        nodes.set(sNode->getId());
+                    }
+                }
+            }
+
+            if (isNonInstricCallSite(&inst))
+            {
+                const CallICFGNode* cs = pag->getICFG()->getCallICFGNode(&inst);
+                if (mssa->hasMU(cs))
+                {
+                    for (MU* mu : mssa->getMUSet(cs))
+                        addActualINSVFGNode(cs, mu->getMRVer(), totalVFGNode++);
+                }
+                if (mssa->hasCHI(cs))
+                {
+                    for (CHI* chi : mssa->getCHISet(cs))
+                        addActualOUTSVFGNode(cs, chi->getResVer(), totalVFGNode++);
+                }
             }
         }
     }
 
-
-    connectFromGlobalToProgEntry();
+    for (CHI* chi : mssa->getFunToEntryChiSetMap()[fun])
+        addFormalINSVFGNode(pag->getICFG()->getFunEntryICFGNode(fun), chi->getResVer(), totalVFGNode++);
+    for (MU* mu : mssa->getFunToRetMuSetMap()[fun])
+        addFormalOUTSVFGNode(pag->getICFG()->getFunExitICFGNode(fun), mu->getMRVer(), totalVFGNode++);
 }
 
-
 /*!
  * Connect indirect SVFG edges from global initializers (store) to main function entry
  */
@@ -580,6 +804,9 @@ void SVFG::dump(const std::string& file, bool simple)
  */
 void SVFG::getInterVFEdgesForIndirectCallSite(const CallICFGNode* callICFGNode, const SVFFunction* callee, SVFGEdgeSetTy& edges)
 {
+    expandFunction(callICFGNode->getCaller());
+    expandFunction(callee);
+
     CallSiteID csId = getCallSiteID(callICFGNode, callee);
     RetICFGNode* retICFGNode = pag->getICFG()->getRetICFGNode(callICFGNode->getCallSite());
 
@@ -654,6 +881,9 @@ void SVFG::getInterVFEdgesForIndirectCallSite(const CallICFGNode* callICFGNode,
  */
 void SVFG::connectCallerAndCallee(const CallICFGNode* cs, const SVFFunction* callee, SVFGEdgeSetTy& edges)
 {
+    expandFunction(cs->getCaller());
+    expandFunction(callee);
+
     VFG::connectCallerAndCallee(cs,callee,edges);
 
     CallSiteID csId = getCallSiteID(cs, callee);
@@ -696,6 +926,25 @@ void SVFG::connectCallerAndCallee(const CallICFGNode* cs, const SVFFunction* cal
     }
 }
 
+/*!
+ * Connect callers and callees of a batch of new call graph edges. Functions
+ * are expanded once for the batch before any of its edges are added.
+ */
+void SVFG::connectCallerAndCallee(const PTACallGraph::CallEdgeMap& newEdges, SVFGEdgeSetTy& edges)
+{
+    for (const PTACallGraph::CallEdgeMap::value_type& csCallees : newEdges)
+    {
+        expandFunction(csCallees.first->getCaller());
+        for (const SVFFunction* callee : csCallees.second)
+            expandFunction(callee);
+    }
+
+    for (const PTACallGraph::CallEdgeMap::value_type& csCallees : newEdges)
+    {
+        for (const SVFFunction* callee : csCallees.second)
+            connectCallerAndCallee(csCallees.first, callee, edges);
+    }
+}
 
 /*!
  * Whether this is an function entry SVFGNode (formal parameter, formal In)
@@ -35,6 +35,7 @@
 #include "Util/Options.h"
 #include "Graphs/SVFGOPT.h"
 #include "Graphs/SVFGStat.h"
+#include "Util/Parallel.h"
 
 using namespace SVF;
 using namespace SVFUtil;
@@ -102,6 +103,7 @@ void SVFGOPT::handleInterValueFlow()
     }
 
     SVFGNodeSet nodesToBeDeleted;
+    std::vector<SVFGNode*> aInFOuts;
     for (SVFGNodeSet::const_iterator it = candidates.begin(), eit = candidates.end();
             it!=eit; ++it)
     {
@@ -122,7 +124,7 @@ void SVFGOPT::handleInterValueFlow()
         }
         else if (SVFUtil::isa<ActualINSVFGNode>(node) || SVFUtil::isa<FormalOUTSVFGNode>(node))
         {
-            retargetEdgesOfAInFOut(node);
+            aInFOuts.push_back(node);
             nodesToBeDeleted.insert(node);
         }
         else if (SVFUtil::isa<ActualOUTSVFGNode>(node) || SVFUtil::isa<FormalINSVFGNode>(node))
@@ -132,6 +134,14 @@ void SVFGOPT::handleInterValueFlow()
         }
     }
 
+    /// Bypassing actual-ins/formal-outs only touches indirect edges, while
+    /// the phis above replace direct ones, so they can be done afterwards.
+    std::sort(aInFOuts.begin(), aInFOuts.end(), [](const SVFGNode* lhs, const SVFGNode* rhs)
+    {
+        return lhs->getId() < rhs->getId();
+    });
+    retargetEdgesOfAInFOut(aInFOuts);
+
     for (SVFGNodeSet::iterator it = nodesToBeDeleted.begin(), eit = nodesToBeDeleted.end(); it != eit; ++it)
     {
         SVFGNode* node = *it;
@@ -199,50 +209,65 @@ void SVFGOPT::replaceFParamARetWithPHI(PHISVFGNode* phi, SVFGNode* svfgNode)
 }
 
 /*!
- * Record def sites of actual-in/formal-out and connect from those def-sites
- * to formal-in/actual-out directly if they exist.
+ * Record def sites of actual-ins/formal-outs and connect from those def-sites
+ * to formal-ins/actual-outs directly if they exist.
+ * The new edges of a node only depend on its own edges, so they are collected
+ * in parallel first and then added in the order of nodes.
  */
-void SVFGOPT::retargetEdgesOfAInFOut(SVFGNode* node)
+void SVFGOPT::retargetEdgesOfAInFOut(const std::vector<SVFGNode*>& nodes)
 {
-    assert(node->getInEdges().size() == 1 && "actual-in/formal-out can only have one incoming edge as its def size");
-
-    SVFGNode* def = nullptr;
-    NodeBS inPointsTo;
-
-    SVFGNode::const_iterator it = node->InEdgeBegin();
-    SVFGNode::const_iterator eit = node->InEdgeEnd();
-    for (; it != eit; ++it)
+    std::vector<AInFOutRetarget> retargets(nodes.size());
+    parallelFor(nodes.size(), getNumOfThreads(Options::SVFGThreads), [&](u32_t i, u32_t)
     {
-        const IndirectSVFGEdge* inEdge = SVFUtil::cast<IndirectSVFGEdge>(*it);
-        inPointsTo = inEdge->getPointsTo();
+        collectRetargetedEdges(nodes[i], retargets[i]);
+    });
 
-        def = inEdge->getSrcNode();
+    for (u32_t i = 0; i < nodes.size(); ++i)
+    {
+        SVFGNode* node = nodes[i];
+        const AInFOutRetarget& retarget = retargets[i];
         if (SVFUtil::isa<ActualINSVFGNode>(node))
-            setActualINDef(node->getId(), def->getId());
+            setActualINDef(node->getId(), retarget.def);
         else if (SVFUtil::isa<FormalOUTSVFGNode>(node))
-            setFormalOUTDef(node->getId(), def->getId());
+            setFormalOUTDef(node->getId(), retarget.def);
+
+        for (const std::pair<const IndirectSVFGEdge*, NodeBS>& edgePts : retarget.outEdges)
+        {
+            const IndirectSVFGEdge* outEdge = edgePts.first;
+            NodeID dstId = outEdge->getDstID();
+            if (const CallIndSVFGEdge* callEdge = SVFUtil::dyn_cast<CallIndSVFGEdge>(outEdge))
+                addCallIndirectSVFGEdge(retarget.def, dstId, callEdge->getCallSiteId(), edgePts.second);
+            else if (const RetIndSVFGEdge* retEdge = SVFUtil::dyn_cast<RetIndSVFGEdge>(outEdge))
+                addRetIndirectSVFGEdge(retarget.def, dstId, retEdge->getCallSiteId(), edgePts.second);
+            else
+                assert(false && "expecting an inter-procedural SVFG edge");
+        }
+
+        removeAllEdges(node);
     }
+}
 
-    it = node->OutEdgeBegin(), eit = node->OutEdgeEnd();
-    for (; it != eit; ++it)
+/*!
+ * Collect the def site of an actual-in/formal-out and the points-to flowing
+ * through each of its outgoing edges. Only reads the graph.
+ */
+void SVFGOPT::collectRetargetedEdges(const SVFGNode* node, AInFOutRetarget& retarget) const
+{
+    assert(node->getInEdges().size() == 1 && "actual-in/formal-out can only have one incoming edge as its def size");
+
+    const IndirectSVFGEdge* inEdge = SVFUtil::cast<IndirectSVFGEdge>(*node->InEdgeBegin());
+    const NodeBS& inPointsTo = inEdge->getPointsTo();
+    retarget.def = inEdge->getSrcID();
+
+    for (SVFGNode::const_iterator it = node->OutEdgeBegin(), eit = node->OutEdgeEnd(); it != eit; ++it)
     {
         const IndirectSVFGEdge* outEdge = SVFUtil::cast<IndirectSVFGEdge>(*it);
         NodeBS intersection = inPointsTo;
         intersection &= outEdge->getPointsTo();
 
-        if (intersection.empty())
-            continue;
-
-        SVFGNode* dstNode = outEdge->getDstNode();
-        if (const CallIndSVFGEdge* callEdge = SVFUtil::dyn_cast<CallIndSVFGEdge>(outEdge))
-            addCallIndirectSVFGEdge(def->getId(), dstNode->getId(), callEdge->getCallSiteId(), intersection);
-        else if (const RetIndSVFGEdge* retEdge = SVFUtil::dyn_cast<RetIndSVFGEdge>(outEdge))
-            addRetIndirectSVFGEdge(def->getId(), dstNode->getId(), retEdge->getCallSiteId(), intersection);
-        else
-            assert(false && "expecting an inter-procedural SVFG edge");
+        if (!intersection.empty())
+            retarget.outEdges.push_back(std::make_pair(outEdge, intersection));
     }
-
-    removeAllEdges(node);
 }
 
 /*!
@@ -91,7 +91,7 @@ void SVFG::writeToFile(const string& filename)
             //node
             f << "SVFGNodeID: " << nodeId << " >= " << "PHISVFGNode";
             unordered_map<u32_t,const MRVer*> opvers;
-            for (MemSSA::PHI::OPVers::const_iterator it = phiNode->opVerBegin(), eit = phiNode->opVerEnd();
+            for (MSSAPHISVFGNode::OPVers::const_iterator it = phiNode->opVerBegin(), eit = phiNode->opVerEnd();
                     it != eit; it++)
             {
                 opvers.insert(make_pair(it->first, it->second));
@@ -184,7 +184,7 @@ void SVFG::writeToFile(const string& filename)
         }
         else if(const MSSAPHISVFGNode* phiNode = SVFUtil::dyn_cast<MSSAPHISVFGNode>(node))
         {
-            for (MemSSA::PHI::OPVers::const_iterator it = phiNode->opVerBegin(), eit = phiNode->opVerEnd();
+            for (MSSAPHISVFGNode::OPVers::const_iterator it = phiNode->opVerBegin(), eit = phiNode->opVerEnd();
                     it != eit; it++)
             {
                 const MRVer* op = it->second;
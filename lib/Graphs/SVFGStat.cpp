@@ -142,6 +142,8 @@ SVFGStat::SVFGStat(SVFG* g) : PTAStat(nullptr)
     addTopLevelNodeTimeStart = addTopLevelNodeTimeEnd = 0;
     addAddrTakenNodeTimeStart = addAddrTakenNodeTimeEnd = 0;
     svfgOptTimeStart = svfgOptTimeEnd = 0;
+    _vmrssUsageBefore = _vmrssUsageAfter = 0;
+    _vmsizeUsageBefore = _vmsizeUsageAfter = 0;
 }
 
 void SVFGStat::clear()
@@ -160,6 +162,7 @@ void SVFGStat::clear()
     totalInEdge = totalOutEdge = 0;
     totalIndInEdge = totalIndOutEdge = 0;
     totalIndEdgeLabels = 0;
+    indEdgeLabelSets.clear();
 
     totalIndCallEdge = totalIndRetEdge = 0;
     totalDirCallEdge = totalDirRetEdge = 0;
@@ -221,6 +224,15 @@ void SVFGStat::performStat()
     PTNumStatMap["DirectEdge"] = totalInEdge - totalIndInEdge;
     PTNumStatMap["IndirectEdge"] = totalIndInEdge;
     PTNumStatMap["IndirectEdgeLabels"] = totalIndEdgeLabels;
+    // labels actually stored, each distinct set being shared by its edges
+    u32_t sharedIndEdgeLabels = 0;
+    for (PointsToID label : indEdgeLabelSets)
+        sharedIndEdgeLabels += IndirectSVFGEdge::getPtsCache().getActualPts(label).count();
+    PTNumStatMap["IndEdgeLabelSets"] = indEdgeLabelSets.size();
+    PTNumStatMap["SharedIndEdgeLabels"] = sharedIndEdgeLabels;
+
+    PTNumStatMap["MemoryUsageVmrss"] = _vmrssUsageAfter - _vmrssUsageBefore;
+    PTNumStatMap["MemoryUsageVmsize"] = _vmsizeUsageAfter - _vmsizeUsageBefore;
 
     PTNumStatMap["IndCallEdge"] = totalIndCallEdge;
     PTNumStatMap["IndRetEdge"] = totalIndRetEdge;
@@ -322,6 +334,7 @@ void SVFGStat::calculateNodeDegrees(SVFGNode* node, NodeSet& nodeHasIndInEdge, N
             const NodeBS& cpts = edge->getPointsTo();
             avgWeight += cpts.count();
             totalIndEdgeLabels += cpts.count();
+            indEdgeLabelSets.insert(edge->getPointsToID());
         }
 
         if (SVFUtil::isa<CallDirSVFGEdge>(*edgeIt))
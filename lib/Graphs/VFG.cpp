@@ -33,6 +33,7 @@
 #include "Graphs/VFG.h"
 #include "Util/SVFModule.h"
 #include "Util/SVFUtil.h"
+#include "Util/Parallel.h"
 
 using namespace SVF;
 using namespace SVFUtil;
@@ -738,72 +739,27 @@ VFGEdge* VFG::addRetEdge(NodeID srcId, NodeID dstId, CallSiteID csId)
  */
 void VFG::connectDirectVFGEdges()
 {
+    /// Intra-procedural edges only need the defs of SVFVars, so they are
+    /// collected for each function in parallel and added afterwards.
+    std::vector<std::vector<const VFGNode*>> funNodes;
+    getNodesOfFunctions(funNodes);
+    std::vector<DirectVFEdgeList> funEdges(funNodes.size());
+    parallelFor(funNodes.size(), getNumOfThreads(Options::SVFGThreads), [&](u32_t i, u32_t)
+    {
+        for (const VFGNode* node : funNodes[i])
+            collectIntraDirectVFEdges(node, funEdges[i]);
+    });
+    for (const DirectVFEdgeList& edges : funEdges)
+    {
+        for (const std::pair<NodeID, NodeID>& edge : edges)
+            addIntraDirectVFEdge(edge.first, edge.second);
+    }
 
     for(iterator it = begin(), eit = end(); it!=eit; ++it)
     {
-        NodeID nodeId = it->first;
         VFGNode* node = it->second;
 
-        if(StmtVFGNode* stmtNode = SVFUtil::dyn_cast<StmtVFGNode>(node))
-        {
-            /// do not handle AddrSVFG node, as it is already the source of a definition
-            if(SVFUtil::isa<AddrVFGNode>(stmtNode))
-                continue;
-            /// for all other cases, like copy/gep/load/ret, connect the RHS pointer to its def
-            if (stmtNode->getPAGSrcNode()->isConstantData() == false)
-                addIntraDirectVFEdge(getDef(stmtNode->getPAGSrcNode()), nodeId);
-
-            /// for store, connect the RHS/LHS pointer to its def
-            if(SVFUtil::isa<StoreVFGNode>(stmtNode) && (stmtNode->getPAGDstNode()->isConstantData() == false))
-            {
-                addIntraDirectVFEdge(getDef(stmtNode->getPAGDstNode()), nodeId);
-            }
-
-        }
-        else if(PHIVFGNode* phiNode = SVFUtil::dyn_cast<PHIVFGNode>(node))
-        {
-            for (PHIVFGNode::OPVers::const_iterator it = phiNode->opVerBegin(), eit = phiNode->opVerEnd(); it != eit; it++)
-            {
-                if (it->second->isConstantData() == false)
-                    addIntraDirectVFEdge(getDef(it->second), nodeId);
-            }
-        }
-        else if(BinaryOPVFGNode* binaryNode = SVFUtil::dyn_cast<BinaryOPVFGNode>(node))
-        {
-            for (BinaryOPVFGNode::OPVers::const_iterator it = binaryNode->opVerBegin(), eit = binaryNode->opVerEnd(); it != eit; it++)
-            {
-                if (it->second->isConstantData() == false)
-                    addIntraDirectVFEdge(getDef(it->second), nodeId);
-            }
-        }
-        else if(UnaryOPVFGNode* unaryNode = SVFUtil::dyn_cast<UnaryOPVFGNode>(node))
-        {
-            for (UnaryOPVFGNode::OPVers::const_iterator it = unaryNode->opVerBegin(), eit = unaryNode->opVerEnd(); it != eit; it++)
-            {
-                if (it->second->isConstantData() == false)
-                    addIntraDirectVFEdge(getDef(it->second), nodeId);
-            }
-        }
-        else if(CmpVFGNode* cmpNode = SVFUtil::dyn_cast<CmpVFGNode>(node))
-        {
-            for (CmpVFGNode::OPVers::const_iterator it = cmpNode->opVerBegin(), eit = cmpNode->opVerEnd(); it != eit; it++)
-            {
-                if (it->second->isConstantData() == false)
-                    addIntraDirectVFEdge(getDef(it->second), nodeId);
-            }
-        }
-        else if(BranchVFGNode* branchNode = SVFUtil::dyn_cast<BranchVFGNode>(node))
-        {
-            const SVFVar* cond = branchNode->getBranchStmt()->getCondition();
-            if (cond->isConstantData() == false)
-                addIntraDirectVFEdge(getDef(cond), nodeId);
-        }
-        else if(ActualParmVFGNode* actualParm = SVFUtil::dyn_cast<ActualParmVFGNode>(node))
-        {
-            if (actualParm->getParam()->isConstantData() == false)
-                addIntraDirectVFEdge(getDef(actualParm->getParam()), nodeId);
-        }
-        else if(FormalParmVFGNode* formalParm = SVFUtil::dyn_cast<FormalParmVFGNode>(node))
+        if(FormalParmVFGNode* formalParm = SVFUtil::dyn_cast<FormalParmVFGNode>(node))
         {
             for(CallPESet::const_iterator it = formalParm->callPEBegin(), eit = formalParm->callPEEnd();
                     it!=eit; ++it)
@@ -815,9 +771,6 @@ void VFG::connectDirectVFGEdges()
         }
         else if(FormalRetVFGNode* calleeRet = SVFUtil::dyn_cast<FormalRetVFGNode>(node))
         {
-            /// connect formal ret to its definition node
-            addIntraDirectVFEdge(getDef(calleeRet->getRet()), nodeId);
-
             /// connect formal ret to actual ret
             for(RetPESet::const_iterator it = calleeRet->retPEBegin(), eit = calleeRet->retPEEnd(); it!=eit; ++it)
             {
@@ -827,8 +780,6 @@ void VFG::connectDirectVFGEdges()
                 addInterEdgeFromFRToAR(calleeRet,callsiteRev, getCallSiteID(callBlockNode, calleeRet->getFun()));
             }
         }
-        /// Do not process FormalRetVFGNode, as they are connected by copy within callee
-        /// We assume one procedure only has unique return
     }
 
     /// connect direct value-flow edges (parameter passing) for thread fork/join
@@ -857,6 +808,98 @@ void VFG::connectDirectVFGEdges()
     }
 }
 
+/*!
+ * Collect the intra-procedural direct edges into node, i.e., from the defs of
+ * the SVFVars it uses.
+ */
+void VFG::collectIntraDirectVFEdges(const VFGNode* node, DirectVFEdgeList& edges) const
+{
+    NodeID nodeId = node->getId();
+
+    if(const StmtVFGNode* stmtNode = SVFUtil::dyn_cast<StmtVFGNode>(node))
+    {
+        /// do not handle AddrSVFG node, as it is already the source of a definition
+        if(SVFUtil::isa<AddrVFGNode>(stmtNode))
+            return;
+        /// for all other cases, like copy/gep/load/ret, connect the RHS pointer to its def
+        if (stmtNode->getPAGSrcNode()->isConstantData() == false)
+            edges.push_back(std::make_pair(getDef(stmtNode->getPAGSrcNode()), nodeId));
+
+        /// for store, connect the RHS/LHS pointer to its def
+        if(SVFUtil::isa<StoreVFGNode>(stmtNode) && (stmtNode->getPAGDstNode()->isConstantData() == false))
+        {
+            edges.push_back(std::make_pair(getDef(stmtNode->getPAGDstNode()), nodeId));
+        }
+
+    }
+    else if(const PHIVFGNode* phiNode = SVFUtil::dyn_cast<PHIVFGNode>(node))
+    {
+        for (PHIVFGNode::OPVers::const_iterator it = phiNode->opVerBegin(), eit = phiNode->opVerEnd(); it != eit; it++)
+        {
+            if (it->second->isConstantData() == false)
+                edges.push_back(std::make_pair(getDef(it->second), nodeId));
+        }
+    }
+    else if(const BinaryOPVFGNode* binaryNode = SVFUtil::dyn_cast<BinaryOPVFGNode>(node))
+    {
+        for (BinaryOPVFGNode::OPVers::const_iterator it = binaryNode->opVerBegin(), eit = binaryNode->opVerEnd(); it != eit; it++)
+        {
+            if (it->second->isConstantData() == false)
+                edges.push_back(std::make_pair(getDef(it->second), nodeId));
+        }
+    }
+    else if(const UnaryOPVFGNode* unaryNode = SVFUtil::dyn_cast<UnaryOPVFGNode>(node))
+    {
+        for (UnaryOPVFGNode::OPVers::const_iterator it = unaryNode->opVerBegin(), eit = unaryNode->opVerEnd(); it != eit; it++)
+        {
+            if (it->second->isConstantData() == false)
+                edges.push_back(std::make_pair(getDef(it->second), nodeId));
+        }
+    }
+    else if(const CmpVFGNode* cmpNode = SVFUtil::dyn_cast<CmpVFGNode>(node))
+    {
+        for (CmpVFGNode::OPVers::const_iterator it = cmpNode->opVerBegin(), eit = cmpNode->opVerEnd(); it != eit; it++)
+        {
+            if (it->second->isConstantData() == false)
+                edges.push_back(std::make_pair(getDef(it->second), nodeId));
+        }
+    }
+    else if(const BranchVFGNode* branchNode = SVFUtil::dyn_cast<BranchVFGNode>(node))
+    {
+        const SVFVar* cond = branchNode->getBranchStmt()->getCondition();
+        if (cond->isConstantData() == false)
+            edges.push_back(std::make_pair(getDef(cond), nodeId));
+    }
+    else if(const ActualParmVFGNode* actualParm = SVFUtil::dyn_cast<ActualParmVFGNode>(node))
+    {
+        if (actualParm->getParam()->isConstantData() == false)
+            edges.push_back(std::make_pair(getDef(actualParm->getParam()), nodeId));
+    }
+    else if(const FormalRetVFGNode* calleeRet = SVFUtil::dyn_cast<FormalRetVFGNode>(node))
+    {
+        /// connect formal ret to its definition node
+        edges.push_back(std::make_pair(getDef(calleeRet->getRet()), nodeId));
+    }
+    /// Formal params are connected to actual params by connectDirectVFGEdges
+}
+
+/*!
+ * Group nodes by their function, in the order the groups are first met
+ */
+void VFG::getNodesOfFunctions(std::vector<std::vector<const VFGNode*>>& funNodes) const
+{
+    Map<const SVFFunction*, u32_t> funToGroup;
+    for(const_iterator it = begin(), eit = end(); it!=eit; ++it)
+    {
+        const VFGNode* node = it->second;
+        std::pair<Map<const SVFFunction*, u32_t>::iterator, bool> group =
+            funToGroup.insert(std::make_pair(node->getFun(), funNodes.size()));
+        if (group.second)
+            funNodes.emplace_back();
+        funNodes[group.first->second].push_back(node);
+    }
+}
+
 /*!
  * Whether we has an intra VFG edge
  */
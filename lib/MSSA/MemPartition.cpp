@@ -78,7 +78,7 @@ void DistinctMRG::createDistinctMR(const SVFFunction* func, const NodeBS& pts)
         cptsToRepCPtsMap[newPts] = newPts;
 
         // add memory region for this points-to target.
-        createMR(func, newPts);
+        objToMRMap[id] = createMR(func, newPts);
     }
 }
 
@@ -96,15 +96,9 @@ void DistinctMRG::getMRsForLoad(MRSet& mrs, const NodeBS& pts, const SVFFunction
     NodeBS::iterator ptsEit = pts.end();
     for (; ptsIt != ptsEit; ++ptsIt)
     {
-        NodeID id = *ptsIt;
-        // create new conditional points-to set with this single element.
-        NodeBS newPts;
-        newPts.set(id);
-
-        MemRegion mr(newPts);
-        MRSet::iterator mit = memRegSet.find(&mr);
-        assert(mit!=memRegSet.end() && "memory region not found!!");
-        mrs.insert(*mit);
+        ObjToMRMap::const_iterator mit = objToMRMap.find(*ptsIt);
+        assert(mit!=objToMRMap.end() && "memory region not found!!");
+        mrs.insert(mit->second);
     }
 }
 
@@ -246,12 +240,7 @@ void IntraDisjointMRG::getMRsForLoadFromInterList(MRSet& mrs, const NodeBS& cpts
     {
         const NodeBS& inter = *it;
         if (cpts.contains(inter))
-        {
-            MemRegion mr(inter);
-            MRSet::iterator mit = memRegSet.find(&mr);
-            assert(mit!=memRegSet.end() && "memory region not found!!");
-            mrs.insert(*mit);
-        }
+            mrs.insert(getMR(inter));
     }
 }
 
@@ -29,6 +29,7 @@
 
 #include "Util/Options.h"
 #include "Util/SVFModule.h"
+#include "Util/Parallel.h"
 #include "MSSA/MemRegion.h"
 #include "MSSA/MSSAMuChi.h"
 
@@ -36,7 +37,7 @@ using namespace SVF;
 using namespace SVFUtil;
 
 u32_t MemRegion::totalMRNum = 0;
-u32_t MRVer::totalVERNum = 0;
+std::atomic<u32_t> MRVer::totalVERNum(0);
 
 MRGenerator::MRGenerator(BVDataPTAImpl* p, bool ptrOnly) :
     pta(p), ptrOnlyMSSA(ptrOnly)
@@ -66,35 +67,41 @@ void MRGenerator::destroy()
 /*!
  * Generate a memory region and put in into functions which use it
  */
-void MRGenerator::createMR(const SVFFunction* fun, const NodeBS& cpts)
+const MemRegion* MRGenerator::createMR(const SVFFunction* fun, const NodeBS& cpts)
 {
-    const NodeBS& repCPts = getRepPointsTo(cpts);
-    MemRegion mr(repCPts);
-    MRSet::const_iterator mit = memRegSet.find(&mr);
-    if(mit!=memRegSet.end())
+    PtsToMRMap::const_iterator mit = ptsToMRMap.find(cpts);
+    const MemRegion* mr = nullptr;
+    if(mit!=ptsToMRMap.end())
     {
-        const MemRegion* mr = *mit;
-        MRSet& mrs = funToMRsMap[fun];
-        if(mrs.find(mr)==mrs.end())
-            mrs.insert(mr);
+        mr = mit->second;
     }
     else
     {
-        MemRegion* m = new MemRegion(repCPts);
-        memRegSet.insert(m);
-        funToMRsMap[fun].insert(m);
+        const NodeBS& repCPts = getRepPointsTo(cpts);
+        const MemRegion*& repMR = ptsToMRMap[repCPts];
+        if(repMR == nullptr)
+        {
+            repMR = new MemRegion(repCPts);
+            memRegSet.insert(repMR);
+        }
+        mr = repMR;
+        ptsToMRMap[cpts] = mr;
     }
+
+    funToMRsMap[fun].insert(mr);
+    return mr;
 }
 
 /*!
- * Generate a memory region and put in into functions which use it
+ * Get the memory region of cpts
  */
 const MemRegion* MRGenerator::getMR(const NodeBS& cpts) const
 {
-    MemRegion mr(getRepPointsTo(cpts));
-    MRSet::iterator mit = memRegSet.find(&mr);
-    assert(mit!=memRegSet.end() && "memory region not found!!");
-    return *mit;
+    PtsToMRMap::const_iterator mit = ptsToMRMap.find(cpts);
+    if(mit==ptsToMRMap.end())
+        mit = ptsToMRMap.find(getRepPointsTo(cpts));
+    assert(mit!=ptsToMRMap.end() && "memory region not found!!");
+    return mit->second;
 }
 
 
@@ -238,20 +245,24 @@ void MRGenerator::collectModRefForCall()
 
     DBOUT(DGENERAL, outs() << pasMsg("\t\tPerform Callsite Mod-Ref \n"));
 
-    WorkList worklist;
-    getCallGraphSCCRevTopoOrder(worklist);
+    /// Side effects flow from callees to callers, so SCCs are processed level
+    /// by level, callees first. SCCs of the same level do not call each other:
+    /// they are processed in parallel, each thread recording what it finds in
+    /// its own delta, which are merged before moving on to the next level.
+    std::vector<std::vector<NodeID>> levels;
+    getCallGraphSCCLevels(levels);
 
-    while(!worklist.empty())
+    u32_t numThreads = getNumOfThreads(Options::MSSAThreads);
+    std::vector<ModRefDelta> deltas(numThreads);
+    for (const std::vector<NodeID>& reps : levels)
     {
-        NodeID callGraphNodeID = worklist.pop();
-        /// handle all sub scc nodes of this rep node
-        const NodeBS& subNodes = callGraphSCC->subNodes(callGraphNodeID);
-        for(NodeBS::iterator it = subNodes.begin(), eit = subNodes.end(); it!=eit; ++it)
+        parallelFor(reps.size(), numThreads, [&](u32_t i, u32_t thread)
         {
-            PTACallGraphNode* subCallGraphNode = callGraph->getCallGraphNode(*it);
-            /// Get mod-ref of all callsites calling callGraphNode
-            modRefAnalysis(subCallGraphNode,worklist);
-        }
+            modRefAnalysis(reps[i], deltas[thread]);
+        });
+
+        for (ModRefDelta& delta : deltas)
+            mergeModRefDelta(delta);
     }
 
     DBOUT(DGENERAL, outs() << pasMsg("\t\tAdd PointsTo to Callsites \n"));
@@ -427,15 +438,39 @@ void MRGenerator::addModSideEffectOfFunction(const SVFFunction* fun, const NodeB
 /*!
  * Add indirect uses an memory object in the function
  */
-bool MRGenerator::addRefSideEffectOfCallSite(const CallICFGNode* cs, const NodeBS& refs)
+void MRGenerator::addRefSideEffectOfFunction(const SVFFunction* fun, const NodeBS& refs, ModRefDelta& delta)
+{
+    for(NodeBS::iterator it = refs.begin(), eit = refs.end(); it!=eit; ++it)
+    {
+        if(isNonLocalObject(*it,fun))
+            delta.funToRefs[fun].set(*it);
+    }
+}
+
+/*!
+ * Add indirect def an memory object in the function
+ */
+void MRGenerator::addModSideEffectOfFunction(const SVFFunction* fun, const NodeBS& mods, ModRefDelta& delta)
+{
+    for(NodeBS::iterator it = mods.begin(), eit = mods.end(); it!=eit; ++it)
+    {
+        if(isNonLocalObject(*it,fun))
+            delta.funToMods[fun].set(*it);
+    }
+}
+
+/*!
+ * Add indirect uses an memory object in the function
+ */
+bool MRGenerator::addRefSideEffectOfCallSite(const CallICFGNode* cs, const NodeBS& refs, ModRefDelta& delta)
 {
     if(!refs.empty())
     {
         NodeBS refset = refs;
         refset &= getCallSiteArgsPts(cs);
         getEscapObjviaGlobals(refset,refs);
-        addRefSideEffectOfFunction(cs->getCaller(),refset);
-        return csToRefsMap[cs] |= refset;
+        addRefSideEffectOfFunction(cs->getCaller(),refset,delta);
+        return delta.csToRefs[cs] |= refset;
     }
     return false;
 }
@@ -443,32 +478,99 @@ bool MRGenerator::addRefSideEffectOfCallSite(const CallICFGNode* cs, const NodeB
 /*!
  * Add indirect def an memory object in the function
  */
-bool MRGenerator::addModSideEffectOfCallSite(const CallICFGNode* cs, const NodeBS& mods)
+bool MRGenerator::addModSideEffectOfCallSite(const CallICFGNode* cs, const NodeBS& mods, ModRefDelta& delta)
 {
     if(!mods.empty())
     {
         NodeBS modset = mods;
         modset &= (getCallSiteArgsPts(cs) | getCallSiteRetPts(cs));
         getEscapObjviaGlobals(modset,mods);
-        addModSideEffectOfFunction(cs->getCaller(),modset);
-        return csToModsMap[cs] |= modset;
+        addModSideEffectOfFunction(cs->getCaller(),modset,delta);
+        return delta.csToMods[cs] |= modset;
     }
     return false;
 }
 
+NodeBS MRGenerator::getRefSideEffectOfFunction(const SVFFunction* fun, const ModRefDelta& delta) const
+{
+    NodeBS refs;
+    FunToPointsToMap::const_iterator it = funToRefsMap.find(fun);
+    if (it != funToRefsMap.end())
+        refs = it->second;
+    it = delta.funToRefs.find(fun);
+    if (it != delta.funToRefs.end())
+        refs |= it->second;
+    return refs;
+}
+
+NodeBS MRGenerator::getModSideEffectOfFunction(const SVFFunction* fun, const ModRefDelta& delta) const
+{
+    NodeBS mods;
+    FunToPointsToMap::const_iterator it = funToModsMap.find(fun);
+    if (it != funToModsMap.end())
+        mods = it->second;
+    it = delta.funToMods.find(fun);
+    if (it != delta.funToMods.end())
+        mods |= it->second;
+    return mods;
+}
+
+void MRGenerator::mergeModRefDelta(ModRefDelta& delta)
+{
+    for (FunToPointsToMap::value_type& funRefs : delta.funToRefs)
+        funToRefsMap[funRefs.first] |= funRefs.second;
+    for (FunToPointsToMap::value_type& funMods : delta.funToMods)
+        funToModsMap[funMods.first] |= funMods.second;
+    for (CallSiteToPointsToMap::value_type& csRefs : delta.csToRefs)
+        csToRefsMap[csRefs.first] |= csRefs.second;
+    for (CallSiteToPointsToMap::value_type& csMods : delta.csToMods)
+        csToModsMap[csMods.first] |= csMods.second;
+
+    delta.funToRefs.clear();
+    delta.funToMods.clear();
+    delta.csToRefs.clear();
+    delta.csToMods.clear();
+}
+
 
 /*!
- * Get the reverse topo order of scc call graph
+ * Level of an SCC: 0 if it calls no other SCC, otherwise one more than the
+ * highest level of the SCCs it calls.
  */
-void MRGenerator::getCallGraphSCCRevTopoOrder(WorkList& worklist)
+void MRGenerator::getCallGraphSCCLevels(std::vector<std::vector<NodeID>>& levels)
 {
+    /// Callers come before their callees in topological order.
+    std::vector<NodeID> topoOrder;
+    NodeStack& topoStack = callGraphSCC->topoNodeStack();
+    while(!topoStack.empty())
+    {
+        topoOrder.push_back(topoStack.top());
+        topoStack.pop();
+    }
 
-    NodeStack& topoOrder = callGraphSCC->topoNodeStack();
-    while(!topoOrder.empty())
+    Map<NodeID, u32_t> repToLevel;
+    for (std::vector<NodeID>::reverse_iterator it = topoOrder.rbegin(), eit = topoOrder.rend(); it != eit; ++it)
     {
-        NodeID callgraphNodeID = topoOrder.top();
-        topoOrder.pop();
-        worklist.push(callgraphNodeID);
+        NodeID rep = *it;
+        u32_t level = 0;
+        for (NodeID id : callGraphSCC->subNodes(rep))
+        {
+            const PTACallGraphNode* callGraphNode = callGraph->getCallGraphNode(id);
+            for (const PTACallGraphEdge* edge : callGraphNode->getOutEdges())
+            {
+                NodeID calleeRep = callGraphSCC->repNode(edge->getDstID());
+                if (calleeRep == rep)
+                    continue;
+                Map<NodeID, u32_t>::const_iterator lit = repToLevel.find(calleeRep);
+                assert(lit != repToLevel.end() && "callee SCC not levelled before its caller?");
+                level = std::max(level, lit->second + 1);
+            }
+        }
+
+        repToLevel[rep] = level;
+        if (levels.size() <= level)
+            levels.resize(level + 1);
+        levels[level].push_back(rep);
     }
 }
 
@@ -599,8 +701,9 @@ bool MRGenerator::isNonLocalObject(NodeID id, const SVFFunction* curFun) const
 /*!
  * Get Mod-Ref of a callee function
  */
-bool MRGenerator::handleCallsiteModRef(NodeBS& mod, NodeBS& ref, const CallICFGNode* cs, const SVFFunction* callee)
+bool MRGenerator::handleCallsiteModRef(const CallICFGNode* cs, const SVFFunction* callee, ModRefDelta& delta)
 {
+    NodeBS mod, ref;
     /// if a callee is a heap allocator function, then its mod set of this callsite is the heap object.
     if(isHeapAllocExtCall(cs->getCallSite()))
     {
@@ -616,53 +719,80 @@ bool MRGenerator::handleCallsiteModRef(NodeBS& mod, NodeBS& ref, const CallICFGN
     /// otherwise, we find the mod/ref sets from the callee function, who has definition and been processed
     else
     {
-        mod = getModSideEffectOfFunction(callee);
-        ref = getRefSideEffectOfFunction(callee);
+        mod = getModSideEffectOfFunction(callee, delta);
+        ref = getRefSideEffectOfFunction(callee, delta);
     }
     // add ref set
-    bool refchanged = addRefSideEffectOfCallSite(cs, ref);
+    bool refchanged = addRefSideEffectOfCallSite(cs, ref, delta);
     // add mod set
-    bool modchanged = addModSideEffectOfCallSite(cs, mod);
+    bool modchanged = addModSideEffectOfCallSite(cs, mod, delta);
 
     return refchanged || modchanged;
 }
 
 /*!
  * Call site mod-ref analysis
- * Compute mod-ref of all callsites invoking this call graph node
+ * Compute mod-ref of all callsites invoking the call graph nodes of an SCC
  */
-void MRGenerator::modRefAnalysis(PTACallGraphNode* callGraphNode, WorkList& worklist)
+void MRGenerator::modRefAnalysis(NodeID rep, ModRefDelta& delta)
 {
+    const NodeBS& subNodes = callGraphSCC->subNodes(rep);
 
-    /// add ref/mod set of callee to its invocation callsites at caller
-    for(PTACallGraphNode::iterator it = callGraphNode->InEdgeBegin(), eit = callGraphNode->InEdgeEnd();
-            it!=eit; ++it)
+    /// Calls within the SCC first, until nothing changes: they only change
+    /// functions and callsites of this SCC.
+    bool changed = true;
+    while (changed)
     {
-        PTACallGraphEdge* edge = *it;
-
-        /// handle direct callsites
-        for(PTACallGraphEdge::CallInstSet::iterator cit = edge->getDirectCalls().begin(),
-                ecit = edge->getDirectCalls().end(); cit!=ecit; ++cit)
+        changed = false;
+        for (NodeID id : subNodes)
         {
-            NodeBS mod, ref;
-            const CallICFGNode* cs = (*cit);
-            bool modrefchanged = handleCallsiteModRef(mod, ref, cs, callGraphNode->getFunction());
-            if(modrefchanged)
-                worklist.push(edge->getSrcID());
+            PTACallGraphNode* callGraphNode = callGraph->getCallGraphNode(id);
+            for (const PTACallGraphEdge* edge : callGraphNode->getInEdges())
+            {
+                if (subNodes.test(edge->getSrcID())
+                        && handleCallEdgeModRef(edge, callGraphNode->getFunction(), delta))
+                    changed = true;
+            }
         }
-        /// handle indirect callsites
-        for(PTACallGraphEdge::CallInstSet::iterator cit = edge->getIndirectCalls().begin(),
-                ecit = edge->getIndirectCalls().end(); cit!=ecit; ++cit)
+    }
+
+    /// Side effects of the SCC are final now: add them to the callers.
+    for (NodeID id : subNodes)
+    {
+        PTACallGraphNode* callGraphNode = callGraph->getCallGraphNode(id);
+        for (const PTACallGraphEdge* edge : callGraphNode->getInEdges())
         {
-            NodeBS mod, ref;
-            const CallICFGNode* cs = (*cit);
-            bool modrefchanged = handleCallsiteModRef(mod, ref, cs, callGraphNode->getFunction());
-            if(modrefchanged)
-                worklist.push(edge->getSrcID());
+            if (!subNodes.test(edge->getSrcID()))
+                handleCallEdgeModRef(edge, callGraphNode->getFunction(), delta);
         }
     }
 }
 
+/*!
+ * Add ref/mod set of callee to its invocation callsites at caller
+ */
+bool MRGenerator::handleCallEdgeModRef(const PTACallGraphEdge* edge, const SVFFunction* callee, ModRefDelta& delta)
+{
+    bool changed = false;
+
+    /// handle direct callsites
+    for(PTACallGraphEdge::CallInstSet::const_iterator cit = edge->getDirectCalls().begin(),
+            ecit = edge->getDirectCalls().end(); cit!=ecit; ++cit)
+    {
+        if (handleCallsiteModRef(*cit, callee, delta))
+            changed = true;
+    }
+    /// handle indirect callsites
+    for(PTACallGraphEdge::CallInstSet::const_iterator cit = edge->getIndirectCalls().begin(),
+            ecit = edge->getIndirectCalls().end(); cit!=ecit; ++cit)
+    {
+        if (handleCallsiteModRef(*cit, callee, delta))
+            changed = true;
+    }
+
+    return changed;
+}
+
 /*!
  * Obtain the mod sets for a call, used for external ModRefInfo queries
  */
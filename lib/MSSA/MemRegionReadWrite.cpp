@@ -0,0 +1,255 @@
+//===- MemRegionReadWrite.cpp -- Caching memory regions in a file ------------//
+//
+//                     SVF: Static Value-Flow Analysis
+//
+// Copyright (C) <2013-2017>  <Yulei Sui>
+//
+
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+//
+//===----------------------------------------------------------------------===//
+
+/*
+ * MemRegionReadWrite.cpp
+ *
+ * Writing the memory regions of loads, stores and call sites to a file and
+ * reading them back, so that runs on the same module and points-to results
+ * skip the mod-ref analysis and region partitioning.
+ */
+
+#include "Util/Options.h"
+#include "Util/SVFModule.h"
+#include "MSSA/MemRegion.h"
+#include <fstream>
+#include <sstream>
+
+using namespace SVF;
+using namespace SVFUtil;
+using namespace std;
+
+// Format of file (one entry per line)
+// mssa-cache <key>
+// mr <id> { <pts> }                            regions, in ID order
+// load/store <SVFStmt id> <region ids>         regions of loads/stores
+// ref/mod <call ICFG node id> <region ids>     regions referenced/modified by call sites
+// csref/csmod <call ICFG node id> { <pts> }    side effects of call sites (getModRefInfo)
+
+static void writePts(std::ostream& os, const NodeBS& pts)
+{
+    os << "{ ";
+    for (NodeID o : pts) os << o << " ";
+    os << "}";
+}
+
+static NodeBS readPts(std::istream& is)
+{
+    NodeBS pts;
+    string tok;
+    is >> tok;
+    assert(tok == "{" && "MSSA cache: expecting a points-to set!");
+    while (is >> tok && tok != "}") pts.set(stoul(tok));
+    return pts;
+}
+
+static void writeMRs(std::ostream& os, const MRGenerator::MRSet& mrs)
+{
+    for (const MemRegion* mr : mrs) os << " " << mr->getMRID();
+}
+
+/*!
+ * Hash of what the regions are computed from: the module, the points-to
+ * results and the options used to partition them.
+ */
+std::string MRGenerator::getCacheKey() const
+{
+    size_t h = std::hash<std::string>()(pta->getModule()->getModuleIdentifier());
+    auto combine = [&h](size_t v)
+    {
+        h ^= v + 0x9e3779b9 + (h << 6) + (h >> 2);
+    };
+
+    SVFIR* pag = pta->getPAG();
+    combine(pag->getTotalNodeNum());
+    combine(pag->getTotalEdgeNum());
+    combine(ptrOnlyMSSA);
+    combine(static_cast<size_t>(Options::MemPar.getValue()));
+    combine(Options::IgnoreDeadFun);
+    for (NodeID id = 0; id < pag->getTotalNodeNum(); ++id)
+    {
+        if (!pag->hasGNode(id))
+            continue;
+        const PointsTo& pts = pta->getPts(id);
+        if (pts.empty())
+            continue;
+        combine(id);
+        for (NodeID o : pts) combine(o);
+    }
+
+    std::stringstream ss;
+    ss << std::hex << h;
+    return ss.str();
+}
+
+void MRGenerator::writeToFile(const std::string& filename)
+{
+    outs() << "Writing memory regions to '" << filename << "'...";
+    std::fstream f(filename.c_str(), std::ios_base::out);
+    if (!f.good())
+    {
+        outs() << "  error opening file for writing!\n";
+        return;
+    }
+
+    f << "mssa-cache " << getCacheKey() << "\n";
+
+    // Regions are read back in ID order so that they get the same IDs.
+    OrderedMap<MRID, const MemRegion*> idToMR;
+    for (const MemRegion* mr : memRegSet)
+        idToMR[mr->getMRID()] = mr;
+    for (const OrderedMap<MRID, const MemRegion*>::value_type& idMR : idToMR)
+    {
+        f << "mr " << idMR.first << " ";
+        writePts(f, idMR.second->getPointsTo());
+        f << "\n";
+    }
+
+    for (const LoadsToMRsMap::value_type& loadMRs : loadsToMRsMap)
+    {
+        f << "load " << loadMRs.first->getEdgeID();
+        writeMRs(f, loadMRs.second);
+        f << "\n";
+    }
+    for (const StoresToMRsMap::value_type& storeMRs : storesToMRsMap)
+    {
+        f << "store " << storeMRs.first->getEdgeID();
+        writeMRs(f, storeMRs.second);
+        f << "\n";
+    }
+    for (const CallSiteToMRsMap::value_type& csMRs : callsiteToRefMRsMap)
+    {
+        f << "ref " << csMRs.first->getId();
+        writeMRs(f, csMRs.second);
+        f << "\n";
+    }
+    for (const CallSiteToMRsMap::value_type& csMRs : callsiteToModMRsMap)
+    {
+        f << "mod " << csMRs.first->getId();
+        writeMRs(f, csMRs.second);
+        f << "\n";
+    }
+    for (const CallSiteToPointsToMap::value_type& csRefs : csToRefsMap)
+    {
+        f << "csref " << csRefs.first->getId() << " ";
+        writePts(f, csRefs.second);
+        f << "\n";
+    }
+    for (const CallSiteToPointsToMap::value_type& csMods : csToModsMap)
+    {
+        f << "csmod " << csMods.first->getId() << " ";
+        writePts(f, csMods.second);
+        f << "\n";
+    }
+
+    f.close();
+    if (f.good())
+        outs() << "\n";
+    else
+        outs() << "  error writing file!\n";
+}
+
+/*!
+ * Load the regions written by writeToFile, instead of generating them.
+ * Returns false (and loads nothing) if there is no cache, or if it was
+ * written for another module or other points-to results.
+ */
+bool MRGenerator::readFromFile(const std::string& filename)
+{
+    ifstream F(filename.c_str());
+    if (!F.is_open())
+        return false;
+
+    string line;
+    getline(F, line);
+    istringstream header(line);
+    string magic, key;
+    header >> magic >> key;
+    if (magic != "mssa-cache" || key != getCacheKey())
+    {
+        outs() << "Memory regions in '" << filename << "' are out of date, regenerating them\n";
+        return false;
+    }
+
+    outs() << "Loading memory regions from '" << filename << "'...\n";
+
+    SVFIR* pag = pta->getPAG();
+    Map<EdgeID, const SVFStmt*> idToStmt;
+    for (const SVFStmt* stmt : pag->getSVFStmtSet(SVFStmt::Load))
+        idToStmt[stmt->getEdgeID()] = stmt;
+    for (const SVFStmt* stmt : pag->getSVFStmtSet(SVFStmt::Store))
+        idToStmt[stmt->getEdgeID()] = stmt;
+
+    Map<MRID, const MemRegion*> idToMR;
+    auto readMRs = [&idToMR](std::istream& is, MRSet& mrs)
+    {
+        MRID id;
+        while (is >> id)
+        {
+            assert(idToMR.count(id) && "MSSA cache: unknown memory region!");
+            mrs.insert(idToMR[id]);
+        }
+    };
+    auto getCallSite = [pag](NodeID id)
+    {
+        return SVFUtil::cast<CallICFGNode>(pag->getICFG()->getICFGNode(id));
+    };
+
+    while (getline(F, line))
+    {
+        if (line.empty()) continue;
+
+        istringstream ss(line);
+        string tag;
+        NodeID id;
+        ss >> tag >> id;
+        if (tag == "mr")
+        {
+            const NodeBS pts = readPts(ss);
+            const MemRegion* mr = new MemRegion(pts);
+            memRegSet.insert(mr);
+            ptsToMRMap[pts] = mr;
+            idToMR[id] = mr;
+        }
+        else if (tag == "load" || tag == "store")
+        {
+            assert(idToStmt.count(id) && "MSSA cache: unknown load/store!");
+            const SVFStmt* stmt = idToStmt[id];
+            if (tag == "load")
+                readMRs(ss, loadsToMRsMap[SVFUtil::cast<LoadStmt>(stmt)]);
+            else
+                readMRs(ss, storesToMRsMap[SVFUtil::cast<StoreStmt>(stmt)]);
+        }
+        else if (tag == "ref")
+            readMRs(ss, callsiteToRefMRsMap[getCallSite(id)]);
+        else if (tag == "mod")
+            readMRs(ss, callsiteToModMRsMap[getCallSite(id)]);
+        else if (tag == "csref")
+            csToRefsMap[getCallSite(id)] = readPts(ss);
+        else if (tag == "csmod")
+            csToModsMap[getCallSite(id)] = readPts(ss);
+        else
+            assert(false && "MSSA cache: unknown entry!");
+    }
+
+    return true;
+}
@@ -31,6 +31,7 @@
 #include "MSSA/MemPartition.h"
 #include "MSSA/MemSSA.h"
 #include "Graphs/SVFGStat.h"
+#include <mutex>
 
 using namespace SVF;
 using namespace SVFUtil;
@@ -40,6 +41,9 @@ double MemSSA::timeOfCreateMUCHI  = 0;	///< Time for generating mu/chi for load/
 double MemSSA::timeOfInsertingPHI  = 0;	///< Time for inserting phis
 double MemSSA::timeOfSSARenaming  = 0;	///< Time for SSA rename
 
+/// Guards the timers above when functions are built by several workers.
+static std::mutex timerMutex;
+
 /*!
  * Constructor
  */
@@ -63,11 +67,57 @@ MemSSA::MemSSA(BVDataPTAImpl* p, bool ptrOnlyMSSA) : df(nullptr),dt(nullptr)
 
     /// Generate whole program memory regions
     double mrStart = stat->getClk(true);
-    mrGen->generateMRs();
+    if (Options::MSSACache.empty() || !mrGen->readFromFile(Options::MSSACache))
+    {
+        mrGen->generateMRs();
+        if (!Options::MSSACache.empty())
+            mrGen->writeToFile(Options::MSSACache);
+    }
     double mrEnd = stat->getClk(true);
     timeOfGeneratingMemRegions = (mrEnd - mrStart)/TIMEINTERVAL;
 }
 
+/*!
+ * Worker constructor: regions (and stat) belong to mssa
+ */
+MemSSA::MemSSA(const MemSSA& mssa) : df(nullptr), dt(nullptr)
+{
+    pta = mssa.pta;
+    mrGen = mssa.mrGen;
+    stat = mssa.stat;
+}
+
+MemSSA* MemSSA::createWorker() const
+{
+    return new MemSSA(*this);
+}
+
+/*!
+ * Functions are built by exactly one worker, so the maps are disjoint.
+ */
+void MemSSA::mergeWorker(MemSSA* worker)
+{
+    load2MuSetMap.insert(worker->load2MuSetMap.begin(), worker->load2MuSetMap.end());
+    store2ChiSetMap.insert(worker->store2ChiSetMap.begin(), worker->store2ChiSetMap.end());
+    callsiteToMuSetMap.insert(worker->callsiteToMuSetMap.begin(), worker->callsiteToMuSetMap.end());
+    callsiteToChiSetMap.insert(worker->callsiteToChiSetMap.begin(), worker->callsiteToChiSetMap.end());
+    bb2PhiSetMap.insert(worker->bb2PhiSetMap.begin(), worker->bb2PhiSetMap.end());
+    funToEntryChiSetMap.insert(worker->funToEntryChiSetMap.begin(), worker->funToEntryChiSetMap.end());
+    funToReturnMuSetMap.insert(worker->funToReturnMuSetMap.begin(), worker->funToReturnMuSetMap.end());
+
+    // The mus/chis/phis are ours now; what the worker shared is not its to release.
+    worker->load2MuSetMap.clear();
+    worker->store2ChiSetMap.clear();
+    worker->callsiteToMuSetMap.clear();
+    worker->callsiteToChiSetMap.clear();
+    worker->bb2PhiSetMap.clear();
+    worker->funToEntryChiSetMap.clear();
+    worker->funToReturnMuSetMap.clear();
+    worker->mrGen = nullptr;
+    worker->stat = nullptr;
+    delete worker;
+}
+
 SVFIR* MemSSA::getPAG()
 {
     return pta->getPAG();
@@ -82,6 +132,7 @@ void MemSSA::setCurrentDFDT(DominanceFrontier* f, DominatorTree* t)
     dt = t;
     usedRegs.clear();
     reg2BBMap.clear();
+    reg2UseBBMap.clear();
 }
 
 /*!
@@ -101,18 +152,20 @@ void MemSSA::buildMemSSA(const SVFFunction& fun, DominanceFrontier* f, Dominator
     double muchiStart = stat->getClk(true);
     createMUCHI(fun);
     double muchiEnd = stat->getClk(true);
-    timeOfCreateMUCHI += (muchiEnd - muchiStart)/TIMEINTERVAL;
 
     /// Insert PHI for memory regions
     double phiStart = stat->getClk(true);
     insertPHI(fun);
     double phiEnd = stat->getClk(true);
-    timeOfInsertingPHI += (phiEnd - phiStart)/TIMEINTERVAL;
 
     /// SSA rename for memory regions
     double renameStart = stat->getClk(true);
     SSARename(fun);
     double renameEnd = stat->getClk(true);
+
+    std::lock_guard<std::mutex> timerLock(timerMutex);
+    timeOfCreateMUCHI += (muchiEnd - muchiStart)/TIMEINTERVAL;
+    timeOfInsertingPHI += (phiEnd - phiStart)/TIMEINTERVAL;
     timeOfSSARenaming += (renameEnd - renameStart)/TIMEINTERVAL;
 
 }
@@ -164,9 +217,15 @@ void MemSSA::createMUCHI(const SVFFunction& fun)
                 {
                     const PAGEdge* inst = *bit;
                     if (const LoadStmt* load = SVFUtil::dyn_cast<LoadStmt>(inst))
-                        AddLoadMU(bb, load, mrGen->getLoadMRSet(load));
+                    {
+                        if (mrGen->hasLoadMRSet(load))
+                            AddLoadMU(bb, load, mrGen->getLoadMRSet(load));
+                    }
                     else if (const StoreStmt* store = SVFUtil::dyn_cast<StoreStmt>(inst))
-                        AddStoreCHI(bb, store, mrGen->getStoreMRSet(store));
+                    {
+                        if (mrGen->hasStoreMRSet(store))
+                            AddStoreCHI(bb, store, mrGen->getStoreMRSet(store));
+                    }
                 }
             }
             if (isNonInstricCallSite(inst))
@@ -220,12 +279,30 @@ void MemSSA::insertPHI(const SVFFunction& fun)
     // record whether a phi of mr has already been inserted into the bb.
     BBToMRSetMap bb2MRSetMap;
 
+    // pruned SSA: every region is used by the return mus, so it is live-in
+    // at all blocks reaching a return
+    BBSet retLiveIns;
+    if (Options::PrunedMSSA && !fun.isNotRetFunction())
+    {
+        BBList retBBs;
+        for (const BasicBlock* bb : fun.getReachableBBs())
+        {
+            if (SymbolTableInfo::isReturn(bb->getTerminator()))
+                retBBs.push_back(bb);
+        }
+        collectLiveInBBs(retBBs, BBSet(), retLiveIns);
+    }
+
     // start inserting phi node
     for (MRSet::iterator iter = usedRegs.begin(), eiter = usedRegs.end();
             iter != eiter; ++iter)
     {
         const MemRegion* mr = *iter;
 
+        BBSet liveIns;
+        if (Options::PrunedMSSA)
+            collectLiveInBBs(reg2UseBBMap[mr], retLiveIns, liveIns);
+
         BBList bbs = reg2BBMap[mr];
         while (!bbs.empty())
         {
@@ -246,8 +323,9 @@ void MemSSA::insertPHI(const SVFFunction& fun)
                 if (0 == bb2MRSetMap[pbb].count(mr))
                 {
                     bb2MRSetMap[pbb].insert(mr);
-                    // insert phi node
-                    AddMSSAPHI(pbb,mr);
+                    // insert phi node (pruned SSA: only where mr is live-in)
+                    if (!Options::PrunedMSSA || retLiveIns.count(pbb) || liveIns.count(pbb))
+                        AddMSSAPHI(pbb,mr);
                     // continue to insert phi in its iterative dominate frontiers
                     bbs.push_back(pbb);
                 }
@@ -257,6 +335,32 @@ void MemSSA::insertPHI(const SVFFunction& fun)
 
 }
 
+/*!
+ * A region used in useBBs is live-in at every block reaching one of them
+ * (a chi also uses the region, so no definition kills it on the way)
+ */
+void MemSSA::collectLiveInBBs(const BBList& useBBs, const BBSet& knownLiveIns, BBSet& liveIns) const
+{
+    BBList worklist;
+    for (const BasicBlock* bb : useBBs)
+    {
+        if (0 == knownLiveIns.count(bb) && liveIns.insert(bb).second)
+            worklist.push_back(bb);
+    }
+
+    while (!worklist.empty())
+    {
+        const BasicBlock* bb = worklist.back();
+        worklist.pop_back();
+        for (const_pred_iterator pit = pred_begin(bb), epit = pred_end(bb); pit != epit; ++pit)
+        {
+            const BasicBlock* pred = *pit;
+            if (0 == knownLiveIns.count(pred) && liveIns.insert(pred).second)
+                worklist.push_back(pred);
+        }
+    }
+}
+
 /*!
  * SSA construction algorithm
  */
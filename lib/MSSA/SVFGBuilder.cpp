@@ -29,8 +29,10 @@
 #include "Util/Options.h"
 #include "Util/SVFModule.h"
 #include "Util/SVFUtil.h"
+#include "Util/Parallel.h"
 #include "MSSA/MemSSA.h"
 #include "Graphs/SVFG.h"
+#include "Graphs/SVFGStat.h"
 #include "MSSA/SVFGBuilder.h"
 #include "WPA/Andersen.h"
 
@@ -67,9 +69,15 @@ void SVFGBuilder::buildSVFG()
 SVFG* SVFGBuilder::build(BVDataPTAImpl* pta, VFG::VFGK kind)
 {
 
-    MemSSA* mssa = buildMSSA(pta, (VFG::PTRONLYSVFG==kind || VFG::PTRONLYSVFG_OPT==kind));
+    bool ptrOnlyMSSA = (VFG::PTRONLYSVFG==kind || VFG::PTRONLYSVFG_OPT==kind);
+    /// A lazy SVFG builds the memory SSA of a function when expanding it;
+    /// SVFGOPT rewrites the whole graph, so it is always built eagerly.
+    bool lazySVFG = lazy && (kind == VFG::FULLSVFG || kind == VFG::PTRONLYSVFG);
+    MemSSA* mssa = lazySVFG ? new MemSSA(pta, ptrOnlyMSSA) : buildMSSA(pta, ptrOnlyMSSA);
 
     DBOUT(DGENERAL, outs() << pasMsg("Build Sparse Value-Flow Graph \n"));
+    u32_t vmrssBefore = 0, vmsizeBefore = 0;
+    SVFUtil::getMemoryUsageKB(&vmrssBefore, &vmsizeBefore);
     if(Options::SingleVFG)
     {
         if(globalSvfg==nullptr)
@@ -78,7 +86,7 @@ SVFG* SVFGBuilder::build(BVDataPTAImpl* pta, VFG::VFGK kind)
             if(kind == VFG::FULLSVFG_OPT || kind == VFG::PTRONLYSVFG_OPT)
                 svfg = globalSvfg = new SVFGOPT(mssa, kind);
             else
-                svfg = globalSvfg = new SVFG(mssa, kind);
+                svfg = globalSvfg = new SVFG(mssa, kind, lazySVFG);
             buildSVFG();
         }
     }
@@ -87,7 +95,7 @@ SVFG* SVFGBuilder::build(BVDataPTAImpl* pta, VFG::VFGK kind)
         if(kind == VFG::FULLSVFG_OPT || kind == VFG::PTRONLYSVFG_OPT)
             svfg = new SVFGOPT(mssa, kind);
         else
-            svfg = new SVFG(mssa,kind);
+            svfg = new SVFG(mssa,kind,lazySVFG);
         buildSVFG();
     }
 
@@ -96,7 +104,13 @@ SVFG* SVFGBuilder::build(BVDataPTAImpl* pta, VFG::VFGK kind)
         svfg->updateCallGraph(pta);
 
     if(mssa->getPTA()->printStat())
+    {
+        u32_t vmrssAfter = 0, vmsizeAfter = 0;
+        SVFUtil::getMemoryUsageKB(&vmrssAfter, &vmsizeAfter);
+        svfg->getStat()->setMemUsageBefore(vmrssBefore, vmsizeBefore);
+        svfg->getStat()->setMemUsageAfter(vmrssAfter, vmsizeAfter);
         svfg->performStat();
+    }
 
     if(Options::DumpVFG)
         svfg->dump("svfg_final");
@@ -119,9 +133,7 @@ MemSSA* SVFGBuilder::buildMSSA(BVDataPTAImpl* pta, bool ptrOnlyMSSA)
 
     MemSSA* mssa = new MemSSA(pta, ptrOnlyMSSA);
 
-    DominatorTree dt;
-    MemSSADF df;
-
+    std::vector<const SVFFunction*> funs;
     SVFModule* svfModule = mssa->getPTA()->getModule();
     for (SVFModule::const_iterator iter = svfModule->begin(), eiter = svfModule->end();
             iter != eiter; ++iter)
@@ -131,10 +143,46 @@ MemSSA* SVFGBuilder::buildMSSA(BVDataPTAImpl* pta, bool ptrOnlyMSSA)
         if (isExtCall(fun))
             continue;
 
-        dt.recalculate(*fun->getLLVMFun());
-        df.runOnDT(dt);
+        funs.push_back(fun);
+    }
+
+    u32_t numThreads = getNumOfThreads(Options::MSSAThreads);
+    if (numThreads > funs.size())
+        numThreads = funs.size();
+
+    if (numThreads <= 1)
+    {
+        DominatorTree dt;
+        MemSSADF df;
+        for (const SVFFunction* fun : funs)
+        {
+            dt.recalculate(*fun->getLLVMFun());
+            df.runOnDT(dt);
+
+            mssa->buildMemSSA(*fun, &df, &dt);
+        }
+    }
+    else
+    {
+        /// Once memory regions are generated, the memory SSA of a function
+        /// only depends on that function: each thread builds its share of the
+        /// functions into its own worker, and workers are merged at the end.
+        std::vector<MemSSA*> workers;
+        for (u32_t t = 0; t < numThreads; ++t)
+            workers.push_back(mssa->createWorker());
+        std::vector<DominatorTree> dts(numThreads);
+        std::vector<MemSSADF> dfs(numThreads);
+
+        parallelFor(funs.size(), numThreads, [&](u32_t i, u32_t t)
+        {
+            dts[t].recalculate(*funs[i]->getLLVMFun());
+            dfs[t].runOnDT(dts[t]);
+
+            workers[t]->buildMemSSA(*funs[i], &dfs[t], &dts[t]);
+        });
 
-        mssa->buildMemSSA(*fun, &df, &dt);
+        for (MemSSA* worker : workers)
+            mssa->mergeWorker(worker);
     }
 
     mssa->performStat();
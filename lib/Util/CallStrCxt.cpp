@@ -0,0 +1,59 @@
+//===- CallStrCxt.cpp -- Interned call string contexts ----------------------//
+//
+//                     SVF: Static Value-Flow Analysis
+//
+// Copyright (C) <2013-2017>  <Yulei Sui>
+//
+
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+//
+//===----------------------------------------------------------------------===//
+
+/*
+ * CallStrCxt.cpp
+ */
+
+#include "Util/CallStrCxt.h"
+
+using namespace SVF;
+
+CallStrCxt::Table& CallStrCxt::getTable()
+{
+    static Table table;
+    return table;
+}
+
+u32_t CallStrCxt::Table::getChild(u32_t parent, u32_t cs)
+{
+    std::pair<Map<std::pair<u32_t, u32_t>, u32_t>::iterator, bool> res =
+        children.emplace(std::make_pair(parent, cs), parents.size());
+    if (res.second)
+    {
+        parents.push_back(parent);
+        labels.push_back(cs);
+        CallSites sites(callSites[parent]);
+        sites.push_back(cs);
+        callSites.push_back(std::move(sites));
+    }
+    return res.first->second;
+}
+
+void CallStrCxt::pop_front()
+{
+    assert(!empty() && "empty context!");
+    const CallSites sites(getCallSites());
+    id = 0;
+    for (CallSites::const_iterator it = sites.begin() + 1, eit = sites.end(); it != eit; ++it)
+        push_back(*it);
+}
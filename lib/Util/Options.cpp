@@ -61,6 +61,48 @@ const llvm::cl::opt<unsigned> Options::AnderTimeLimit(
     llvm::cl::desc("time limit for Andersen's analyses (ignored when -fs-time-limit set)")
 );
 
+const llvm::cl::opt<std::string> Options::FsCheckpoint(
+    "fs-checkpoint",
+    llvm::cl::init(""),
+    llvm::cl::desc("write the solver state of flow-sensitive analyses to this file on SIGTERM (and periodically with -fs-checkpoint-interval)")
+);
+
+const llvm::cl::opt<unsigned> Options::FsCheckpointInterval(
+    "fs-checkpoint-interval",
+    llvm::cl::init(0),
+    llvm::cl::desc("seconds between periodic checkpoints of flow-sensitive analyses (0: only on SIGTERM)")
+);
+
+const llvm::cl::opt<std::string> Options::FsResume(
+    "fs-resume",
+    llvm::cl::init(""),
+    llvm::cl::desc("resume flow-sensitive analyses from a checkpoint written by -fs-checkpoint")
+);
+
+const llvm::cl::opt<std::string> Options::FsSnapshot(
+    "fs-snapshot",
+    llvm::cl::init(""),
+    llvm::cl::desc("write a snapshot of the flow-sensitive analysis for later incremental re-analysis")
+);
+
+const llvm::cl::opt<std::string> Options::FsIncremental(
+    "fs-incremental",
+    llvm::cl::init(""),
+    llvm::cl::desc("re-analyse incrementally from a snapshot (-fs-snapshot) of a previous version of the program")
+);
+
+const llvm::cl::opt<bool> Options::FsQueryFunPtrs(
+    "fs-query-fptrs",
+    llvm::cl::init(false),
+    llvm::cl::desc("only solve the part of the SVFG which function pointers depend on (demand-driven flow-sensitive analysis)")
+);
+
+const llvm::cl::opt<bool> Options::RankedWorklist(
+    "ranked-wl",
+    llvm::cl::init(false),
+    llvm::cl::desc("pop worklist nodes of flow-sensitive and Andersen's analyses by topological rank of their SCC")
+);
+
 // ContextDDA.cpp
 const llvm::cl::opt<unsigned long long> Options::CxtBudget(
     "cxt-bg",
@@ -179,6 +221,54 @@ const llvm::cl::opt<bool> Options::WPANum(
     llvm::cl::desc("collect WPA FS number only ")
 );
 
+const llvm::cl::opt<unsigned> Options::DDAThreads(
+    "dda-threads",
+    llvm::cl::init(1),
+    llvm::cl::desc("Number of worker processes answering DDA queries (0 for one per core)")
+);
+
+const llvm::cl::opt<std::string> Options::DDACache(
+    "dda-cache",
+    llvm::cl::init(""),
+    llvm::cl::desc("Answer DDA queries from this file if it was written for the same module and options, and write the results back to it")
+);
+
+const llvm::cl::opt<unsigned long long> Options::DDABudgetPool(
+    "dda-budget-pool",
+    llvm::cl::init(0),
+    llvm::cl::desc("Step budget shared by all DDA queries, each query getting an equal share of what is left (0 for a fixed budget per query)")
+);
+
+const llvm::cl::opt<unsigned> Options::DDATimeBudget(
+    "dda-time-budget",
+    llvm::cl::init(0),
+    llvm::cl::desc("Seconds for answering all DDA queries, later queries get conservative answers (0 for no limit)")
+);
+
+const llvm::cl::opt<bool> Options::DDAServe(
+    "serve",
+    llvm::cl::init(false),
+    llvm::cl::desc("Keep the analysis and answer requests (pts <id>, alias <id> <id>, callees <call site id>, quit) line by line instead of answering -query")
+);
+
+const llvm::cl::opt<std::string> Options::DDAServeSocket(
+    "serve-socket",
+    llvm::cl::init(""),
+    llvm::cl::desc("Read -serve requests from this Unix domain socket rather than stdin")
+);
+
+const llvm::cl::opt<std::string> Options::DDAStatJSON(
+    "dda-stat-json",
+    llvm::cl::init(""),
+    llvm::cl::desc("Write the statistics of every DDA query to this JSON file")
+);
+
+const llvm::cl::opt<unsigned> Options::DDAStatTopK(
+    "dda-stat-topk",
+    llvm::cl::init(10),
+    llvm::cl::desc("Number of slowest DDA queries to report in the statistics")
+);
+
 /// register this into alias analysis group
 //static RegisterAnalysisGroup<AliasAnalysis> AA_GROUP(DDAPA);
 llvm::cl::bits<PointerAnalysis::PTATY> Options::DDASelected(
@@ -451,6 +541,24 @@ const llvm::cl::opt<MemSSA::MemPartition> Options::MemPar(
         clEnumValN(MemSSA::MemPartition::InterDisjoint, "inter-disjoint", "memory regions partioned across functions"))
 );
 
+const llvm::cl::opt<unsigned> Options::MSSAThreads(
+    "mssa-threads",
+    llvm::cl::init(1),
+    llvm::cl::desc("Number of threads computing mod-ref of call graph SCCs and building the memory SSA of functions (0 for one per core)")
+);
+
+const llvm::cl::opt<bool> Options::PrunedMSSA(
+    "pruned-mssa",
+    llvm::cl::init(false),
+    llvm::cl::desc("Only insert memory phis where their region is live (pruned SSA), instead of semi-pruned SSA")
+);
+
+const llvm::cl::opt<std::string> Options::MSSACache(
+    "mssa-cache",
+    llvm::cl::init(""),
+    llvm::cl::desc("Load the memory regions from this file if it was written for the same module and points-to results, otherwise generate and write them")
+);
+
 
 // SVFG builder (SVFGBuilder.cpp)
 const llvm::cl::opt<bool> Options::SVFGWithIndirectCall(
@@ -459,6 +567,18 @@ const llvm::cl::opt<bool> Options::SVFGWithIndirectCall(
     llvm::cl::desc("Update Indirect Calls for SVFG using pre-analysis")
 );
 
+const llvm::cl::opt<bool> Options::LazySVFG(
+    "lazy-svfg",
+    llvm::cl::init(false),
+    llvm::cl::desc("Build the memory SSA and address-taken value-flows of a function when a traversal first reaches it (DDA)")
+);
+
+const llvm::cl::opt<unsigned> Options::SVFGThreads(
+    "svfg-threads",
+    llvm::cl::init(1),
+    llvm::cl::desc("Number of threads building and optimising the SVFG (0 for one per core)")
+);
+
 const llvm::cl::opt<bool> Options::SingleVFG(
     "single-vfg",
     llvm::cl::init(false),
@@ -190,6 +190,8 @@ void Andersen::initialize()
 
     if (Options::ClusterAnder) cluster();
 
+    setUseRankedWorklist(Options::RankedWorklist);
+
     /// Initialize worklist
     processAllAddr();
 }
@@ -617,6 +619,8 @@ NodeStack& Andersen::SCCDetect()
 
     timeOfSCCMerges +=  (mergeEnd - mergeStart)/TIMEINTERVAL;
 
+    rankWorklistNodes(getSCCDetector()->topoNodeStack());
+
     return getSCCDetector()->topoNodeStack();
 }
 
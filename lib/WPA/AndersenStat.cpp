@@ -338,6 +338,11 @@ void AndersenStat::performStat()
     PTNumStatMap[MaxPointsToSetSize] = _MaxPtsSize;
 
     PTNumStatMap[NumOfIterations] = pta->numOfIteration;
+    PTNumStatMap["NodeVisits"] = pta->getNumOfNodeVisits();
+    PTNumStatMap["VisitedNodes"] = pta->getNumOfVisitedNodes();
+    PTNumStatMap["MaxNodeVisits"] = pta->getMaxNodeVisits();
+    timeStatMap["AvgNodeVisits"] = pta->getNumOfVisitedNodes() == 0 ? 0 :
+                                   (double)pta->getNumOfNodeVisits() / pta->getNumOfVisitedNodes();
 
     PTNumStatMap[NumOfIndirectCallSites] = consCG->getIndirectCallsites().size();
     PTNumStatMap[NumOfIndirectEdgeSolved] = pta->getNumOfResolvedIndCallEdge();
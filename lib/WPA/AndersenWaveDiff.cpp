@@ -58,6 +58,7 @@ void AndersenWaveDiff::solveWorklist()
     {
         NodeID nodeId = nodeStack.top();
         nodeStack.pop();
+        recordNodeVisit(nodeId);
         collapsePWCNode(nodeId);
         // process nodes in nodeStack
         processNode(nodeId);
@@ -68,6 +69,7 @@ void AndersenWaveDiff::solveWorklist()
     while (!isWorklistEmpty())
     {
         NodeID nodeId = popFromWorklist();
+        recordNodeVisit(nodeId);
         // process nodes in worklist
         postProcessNode(nodeId);
     }
@@ -49,6 +49,8 @@ void FlowSensitive::initialize()
 
     stat = new FlowSensitiveStat(this);
 
+    setUseRankedWorklist(Options::RankedWorklist);
+
     // TODO: support clustered aux. Andersen's.
     assert(!Options::ClusterAnder && "FlowSensitive::initialize: clustering auxiliary Andersen's unsupported.");
     ander = AndersenWaveDiff::createAndersenWaveDiff(getPAG());
@@ -74,6 +76,59 @@ void FlowSensitive::initialize()
 
     setGraph(svfg);
     //AndersenWaveDiff::releaseAndersenWaveDiff();
+
+    if (Options::FsQueryFunPtrs)
+        demandDriven = true;
+    if (demandDriven)
+        initQuerySlice();
+}
+
+/*!
+ * The slice is everything the queries depend on in the SVFG. Function pointers
+ * are always queried: resolving indirect calls adds the SVFG edges which the
+ * queries may come to depend on.
+ */
+void FlowSensitive::initQuerySlice()
+{
+    assert(getAnalysisTy() == FSSPARSE_WPA && "FS::initQuerySlice: demand-driven solving only supported by FlowSensitive!");
+    assert(Options::FsSnapshot.empty() && Options::FsIncremental.empty()
+           && "FS::initQuerySlice: snapshots of demand-driven runs are incomplete!");
+
+    NodeBS vars = queries;
+    for (const CallSiteToFunPtrMap::value_type& csfp : getIndirectCallsites())
+        vars.set(csfp.second);
+
+    NodeBS newNodes;
+    for (NodeID var : vars)
+    {
+        const PAGNode* pagNode = pag->getGNode(var);
+        if (svfg->hasDefSVFGNode(pagNode))
+            extendQuerySlice(svfg->getDefSVFGNode(pagNode)->getId(), newNodes);
+    }
+}
+
+void FlowSensitive::extendQuerySlice(NodeID node, NodeBS& newNodes)
+{
+    FILOWorkList<NodeID> worklist;
+    if (querySlice.test_and_set(node))
+    {
+        newNodes.set(node);
+        worklist.push(node);
+    }
+
+    while (!worklist.empty())
+    {
+        const SVFGNode* dst = svfg->getSVFGNode(worklist.pop());
+        for (const SVFGEdge* edge : dst->getInEdges())
+        {
+            NodeID src = edge->getSrcID();
+            if (querySlice.test_and_set(src))
+            {
+                newNodes.set(src);
+                worklist.push(src);
+            }
+        }
+    }
 }
 
 /*!
@@ -86,32 +141,60 @@ void FlowSensitive::analyze()
     /// Initialization for the Solver
     initialize();
 
+    /// Pick up where a previous (interrupted) run, or a run on a previous
+    /// version of the program, left off.
+    bool resumed = false;
+    if (!Options::FsResume.empty())
+        resumed = readCheckpoint(Options::FsResume);
+    else if (!Options::FsIncremental.empty())
+        resumed = readSnapshot(Options::FsIncremental);
+
+    bool checkpointing = startCheckpointing();
+
     double start = stat->getClk(true);
     /// Start solving constraints
     DBOUT(DGENERAL, outs() << SVFUtil::pasMsg("Start Solving Constraints\n"));
 
     do
     {
-        numOfIteration++;
+        if (resumed)
+        {
+            /// The worklist and the iteration count come from the checkpoint.
+            resumed = false;
+            callGraphSCC->find();
+        }
+        else
+        {
+            numOfIteration++;
+
+            if(0 == numOfIteration % OnTheFlyIterBudgetForStat)
+                dumpStat();
+
+            callGraphSCC->find();
 
-        if(0 == numOfIteration % OnTheFlyIterBudgetForStat)
-            dumpStat();
+            initWorklist();
+        }
 
-        callGraphSCC->find();
+        /// Objects may have become local variables of recursive functions.
+        suObjs.clear();
 
-        initWorklist();
         solveWorklist();
     }
     while (updateCallGraph(getIndirectCallsites()));
 
     DBOUT(DGENERAL, outs() << SVFUtil::pasMsg("Finish Solving Constraints\n"));
 
+    stopCheckpointing(checkpointing);
+
     // Reset the time-up alarm; analysis is done.
     SVFUtil::stopAnalysisLimitTimer(limitTimerSet);
 
     double end = stat->getClk(true);
     solveTime += (end - start) / TIMEINTERVAL;
 
+    if (!Options::FsSnapshot.empty())
+        writeSnapshot(Options::FsSnapshot);
+
     /// finalize the analysis
     finalize();
 }
@@ -612,7 +695,8 @@ bool FlowSensitive::processStore(const StoreSVFGNode* store)
 bool FlowSensitive::isStrongUpdate(const SVFGNode* node, NodeID& singleton)
 {
     bool isSU = false;
-    if (const StoreSVFGNode* store = SVFUtil::dyn_cast<StoreSVFGNode>(node))
+    const StoreSVFGNode* store = SVFUtil::dyn_cast<StoreSVFGNode>(node);
+    if (store && !weakUpdateStores.test(store->getId()))
     {
         const PointsTo& dstCPSet = getPts(store->getPAGDstNodeID());
         if (dstCPSet.count() == 1)
@@ -620,19 +704,37 @@ bool FlowSensitive::isStrongUpdate(const SVFGNode* node, NodeID& singleton)
             /// Find the unique element in cpts
             PointsTo::iterator it = dstCPSet.begin();
             singleton = *it;
-
-            // Strong update can be made if this points-to target is not heap, array or field-insensitive.
-            if (!isHeapMemObj(singleton) && !isArrayMemObj(singleton)
-                    && pag->getBaseObj(singleton)->isFieldInsensitive() == false
-                    && !isLocalVarInRecursiveFun(singleton))
-            {
-                isSU = true;
-            }
+            isSU = isStrongUpdateObj(singleton);
         }
+        else if (dstCPSet.count() > 1)
+            weakUpdateStores.set(store->getId());
     }
     return isSU;
 }
 
+/*!
+ * Strong update can be made if this points-to target is not heap, array,
+ * field-insensitive, or a local variable of a recursive function.
+ */
+bool FlowSensitive::isStrongUpdateObj(NodeID obj)
+{
+    if (nonSUObjs.test(obj))
+        return false;
+    if (suObjs.test(obj))
+        return true;
+
+    if (isHeapMemObj(obj) || isArrayMemObj(obj)
+            || pag->getBaseObj(obj)->isFieldInsensitive()
+            || isLocalVarInRecursiveFun(obj))
+    {
+        nonSUObjs.set(obj);
+        return false;
+    }
+
+    suObjs.set(obj);
+    return true;
+}
+
 /*!
  * Update call graph
  */
@@ -681,6 +783,18 @@ bool FlowSensitive::updateCallGraph(const CallSiteToFunPtrMap& callsites)
 
     updateConnectedNodes(svfgEdges);
 
+    u32_t numOfCallEdges = 0;
+    for (const CallEdgeMap::value_type& csfs : newEdges)
+        numOfCallEdges += csfs.second.size();
+    if (numOfCallEdges > 0)
+    {
+        ++numOfCGUpdates;
+        numOfNewCallEdges += numOfCallEdges;
+        maxNewCallEdges = std::max(maxNewCallEdges, numOfCallEdges);
+        numOfNewSVFGEdges += svfgEdges.size();
+        maxNewSVFGEdges = std::max(maxNewSVFGEdges, (u32_t) svfgEdges.size());
+    }
+
     double end = stat->getClk();
     updateCallGraphTime += (end - start) / TIMEINTERVAL;
     return (!newEdges.empty());
@@ -691,26 +805,32 @@ bool FlowSensitive::updateCallGraph(const CallSiteToFunPtrMap& callsites)
  */
 void FlowSensitive::connectCallerAndCallee(const CallEdgeMap& newEdges, SVFGEdgeSetTy& edges)
 {
-    CallEdgeMap::const_iterator iter = newEdges.begin();
-    CallEdgeMap::const_iterator eiter = newEdges.end();
-    for (; iter != eiter; iter++)
-    {
-        const CallICFGNode* cs = iter->first;
-        const FunctionSet & functions = iter->second;
-        for (FunctionSet::const_iterator func_iter = functions.begin(); func_iter != functions.end(); func_iter++)
-        {
-            const SVFFunction*  func = *func_iter;
-            svfg->connectCallerAndCallee(cs, func, edges);
-        }
-    }
+    svfg->connectCallerAndCallee(newEdges, edges);
 }
 
 /*!
  * Push nodes connected during update call graph into worklist so they will be
- * solved during next iteration.
+ * solved during next iteration. A node reached by several of the new edges is
+ * pushed once, after the points-to of all its new edges has been propagated.
  */
 void FlowSensitive::updateConnectedNodes(const SVFGEdgeSetTy& edges)
 {
+    if (demandDriven)
+    {
+        /// New edges into the slice pull what they depend on into it. Points-to
+        /// sets have been propagated to the new nodes all along (only pushing
+        /// them was skipped), so solving them as fresh nodes is enough.
+        NodeBS newNodes;
+        for (const SVFGEdge* edge : edges)
+        {
+            if (querySlice.test(edge->getDstID()))
+                extendQuerySlice(edge->getSrcID(), newNodes);
+        }
+        for (NodeID id : newNodes)
+            pushIntoWorklist(id);
+    }
+
+    NodeBS nodesToSolve;
     for (SVFGEdgeSetTy::const_iterator it = edges.begin(), eit = edges.end();
             it != eit; ++it)
     {
@@ -720,7 +840,7 @@ void FlowSensitive::updateConnectedNodes(const SVFGEdgeSetTy& edges)
         {
             /// If this is a formal-param or actual-ret node, we need to solve this phi
             /// node in next iteration
-            pushIntoWorklist(dstNode->getId());
+            nodesToSolve.set(dstNode->getId());
         }
         else if (SVFUtil::isa<FormalINSVFGNode>(dstNode) || SVFUtil::isa<ActualOUTSVFGNode>(dstNode))
         {
@@ -752,9 +872,12 @@ void FlowSensitive::updateConnectedNodes(const SVFGEdgeSetTy& edges)
             }
 
             if (changed)
-                pushIntoWorklist(dstNode->getId());
+                nodesToSolve.set(dstNode->getId());
         }
     }
+
+    for (NodeID id : nodesToSolve)
+        pushIntoWorklist(id);
 }
 
 
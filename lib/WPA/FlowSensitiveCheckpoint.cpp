@@ -0,0 +1,374 @@
+//===- FlowSensitiveCheckpoint.cpp -- Checkpointing flow-sensitive PTA --------//
+//
+//                     SVF: Static Value-Flow Analysis
+//
+// Copyright (C) <2013-2017>  <Yulei Sui>
+//
+
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+//
+//===----------------------------------------------------------------------===//
+
+/*
+ * FlowSensitiveCheckpoint.cpp
+ *
+ * Writing the solver state of flow-sensitive analyses to a file and resuming
+ * from it, so that long runs can survive being killed.
+ */
+
+#include "Util/Options.h"
+#include "WPA/FlowSensitive.h"
+#include <csignal>
+#include <ctime>
+#include <cstdio>
+#include <fstream>
+#include <sstream>
+
+using namespace SVF;
+using namespace SVFUtil;
+using namespace std;
+
+// Format of file (one entry per line)
+// fs-checkpoint <PTA name> <numOfIteration>
+// gep <id> <base id> <field index>             GepObjVars, in ID order
+// fi <base id>                                 field-insensitive objects
+// tl <var> { <pts> }                           top-level points-to sets
+// in/out <svfg node> <var> { <pts> }           address-taken (analysis specific)
+// cg <callsite ICFG node> <callee call graph node>
+// wl <svfg node>                               worklist, in order (analysis specific)
+
+/// Set by the SIGTERM handler; checked between two processed nodes.
+static volatile sig_atomic_t checkpointRequested = 0;
+
+static void requestCheckpoint(int)
+{
+    checkpointRequested = 1;
+}
+
+bool FlowSensitive::startCheckpointing()
+{
+    lastCheckpointTime = time(nullptr);
+    if (Options::FsCheckpoint.empty()) return false;
+
+    checkpointRequested = 0;
+    signal(SIGTERM, &requestCheckpoint);
+    return true;
+}
+
+void FlowSensitive::stopCheckpointing(bool checkpointing)
+{
+    if (checkpointing) signal(SIGTERM, SIG_DFL);
+}
+
+bool FlowSensitive::isCheckpointDue()
+{
+    if (Options::FsCheckpoint.empty()) return false;
+    if (checkpointRequested) return true;
+    return Options::FsCheckpointInterval != 0
+           && difftime(time(nullptr), lastCheckpointTime) >= Options::FsCheckpointInterval;
+}
+
+/*!
+ * Same as WPASolver::solveWorklist, but the state between two nodes is
+ * consistent so that is where we checkpoint.
+ */
+void FlowSensitive::solveWorklist()
+{
+    while (!isWorklistEmpty())
+    {
+        if (isCheckpointDue())
+        {
+            writeCheckpoint(Options::FsCheckpoint);
+            if (checkpointRequested)
+            {
+                // We were asked to terminate; do so the way we were asked.
+                outs().flush();
+                signal(SIGTERM, SIG_DFL);
+                raise(SIGTERM);
+            }
+        }
+
+        NodeID nodeId = popFromWorklist();
+        recordNodeVisit(nodeId);
+        processNode(nodeId);
+        collapseFields();
+    }
+}
+
+void FlowSensitive::writeCheckpointPts(std::ostream& os, const PointsTo& pts)
+{
+    os << "{ ";
+    for (NodeID o : pts) os << o << " ";
+    os << "}";
+}
+
+PointsTo FlowSensitive::readCheckpointPts(std::istream& is)
+{
+    PointsTo pts;
+    string tok;
+    is >> tok;
+    assert(tok == "{" && "FS checkpoint: expecting a points-to set!");
+    while (is >> tok && tok != "}") pts.set(stoul(tok));
+    return pts;
+}
+
+/*!
+ * Write the checkpoint to a temporary file first, then move it over the old
+ * checkpoint so that being killed while writing leaves a usable checkpoint.
+ */
+void FlowSensitive::writeCheckpoint(const std::string& filename)
+{
+    double start = stat->getClk(true);
+    outs() << "Writing " << PTAName() << " checkpoint to '" << filename << "'...";
+
+    string tmpFilename = filename + ".tmp";
+    std::fstream f(tmpFilename.c_str(), std::ios_base::out);
+    if (!f.good())
+    {
+        outs() << "  error opening file for writing!\n";
+        return;
+    }
+
+    f << "fs-checkpoint " << PTAName() << " " << numOfIteration << "\n";
+
+    // Objects created (field nodes) or collapsed while solving. Field nodes are
+    // written in ID order, and before collapsing, so that re-creating them
+    // yields the same IDs.
+    OrderedMap<NodeID, const GepObjVar*> gepObjs;
+    NodeBS fiObjs;
+    for (SVFIR::iterator it = pag->begin(), eit = pag->end(); it != eit; ++it)
+    {
+        if (const GepObjVar* gepObj = SVFUtil::dyn_cast<GepObjVar>(it->second))
+            gepObjs[it->first] = gepObj;
+
+        if (SVFUtil::isa<ObjVar>(it->second))
+        {
+            NodeID base = pag->getBaseObjVar(it->first);
+            if (isFieldInsensitive(base)) fiObjs.set(base);
+        }
+    }
+
+    for (const OrderedMap<NodeID, const GepObjVar*>::value_type& idGep : gepObjs)
+    {
+        f << "gep " << idGep.first << " " << pag->getBaseObjVar(idGep.first)
+          << " " << idGep.second->getConstantFieldIdx() << "\n";
+    }
+
+    for (NodeID base : fiObjs) f << "fi " << base << "\n";
+
+    for (SVFIR::iterator it = pag->begin(), eit = pag->end(); it != eit; ++it)
+    {
+        const PointsTo& pts = getPts(it->first);
+        if (pts.empty()) continue;
+        f << "tl " << it->first << " ";
+        writeCheckpointPts(f, pts);
+        f << "\n";
+    }
+
+    writeCheckpointATPts(f);
+
+    for (const CallEdgeMap::value_type& csfs : getIndCallMap())
+    {
+        for (const SVFFunction* callee : csfs.second)
+        {
+            f << "cg " << csfs.first->getId() << " "
+              << ptaCallGraph->getCallGraphNode(callee)->getId() << "\n";
+        }
+    }
+
+    // The worklist can only be read by popping, so pop and push back in order.
+    std::vector<NodeID> worklistNodes;
+    while (!isWorklistEmpty()) worklistNodes.push_back(popFromWorklist());
+    for (NodeID id : worklistNodes)
+    {
+        writeCheckpointWorklistNode(f, id);
+        pushIntoWorklist(id);
+    }
+
+    f.close();
+    if (!f.good() || rename(tmpFilename.c_str(), filename.c_str()) != 0)
+    {
+        outs() << "  error writing file!\n";
+        return;
+    }
+
+    lastCheckpointTime = time(nullptr);
+    double end = stat->getClk(true);
+    outs() << " (" << (end - start) / TIMEINTERVAL << " s)\n";
+}
+
+/*!
+ * Only address-taken variables on a location's incoming indirect edges (and
+ * all fields of collapsed ones) reach its IN set. Stores additionally define
+ * what their pointer points to in their OUT set.
+ */
+void FlowSensitive::writeCheckpointATPts(std::ostream& os)
+{
+    for (SVFG::iterator it = svfg->begin(), eit = svfg->end(); it != eit; ++it)
+    {
+        NodeID loc = it->first;
+        const SVFGNode* node = it->second;
+
+        NodeBS vars;
+        for (const SVFGEdge* edge : node->getInEdges())
+        {
+            const IndirectSVFGEdge* indEdge = SVFUtil::dyn_cast<IndirectSVFGEdge>(edge);
+            if (indEdge == nullptr) continue;
+            for (NodeID ptd : indEdge->getPointsTo())
+            {
+                vars.set(ptd);
+                if (isFieldInsensitive(ptd)) vars |= getAllFieldsObjVars(ptd);
+            }
+        }
+
+        for (NodeID var : vars)
+        {
+            if (!getDFPTDataTy()->hasDFInSet(loc, var)) continue;
+            const PointsTo& pts = getDFInPtsSet(node, var);
+            if (pts.empty()) continue;
+            os << "in " << loc << " " << var << " ";
+            writeCheckpointPts(os, pts);
+            os << "\n";
+        }
+
+        if (const StoreSVFGNode* store = SVFUtil::dyn_cast<StoreSVFGNode>(node))
+        {
+            for (NodeID ptd : getPts(store->getPAGDstNodeID())) vars.set(ptd);
+            for (NodeID var : vars)
+            {
+                if (!getDFPTDataTy()->hasDFOutSet(loc, var)) continue;
+                const PointsTo& pts = getDFOutPtsSet(node, var);
+                if (pts.empty()) continue;
+                os << "out " << loc << " " << var << " ";
+                writeCheckpointPts(os, pts);
+                os << "\n";
+            }
+        }
+    }
+}
+
+void FlowSensitive::writeCheckpointWorklistNode(std::ostream& os, NodeID id)
+{
+    os << "wl " << id << "\n";
+}
+
+bool FlowSensitive::readCheckpointLine(const std::string& tag, std::istream& is)
+{
+    if (tag == "in" || tag == "out")
+    {
+        NodeID loc, var;
+        is >> loc >> var;
+        assert(svfg->hasSVFGNode(loc) && "FS checkpoint: unknown SVFG node!");
+        const PointsTo pts = readCheckpointPts(is);
+        if (tag == "in") getDFPTDataTy()->unionDFInPts(loc, var, pts);
+        else getDFPTDataTy()->unionDFOutPts(loc, var, pts);
+    }
+    else if (tag == "wl")
+    {
+        NodeID id;
+        is >> id;
+        assert(svfg->hasSVFGNode(id) && "FS checkpoint: unknown SVFG node!");
+        pushIntoWorklist(id);
+    }
+    else return false;
+
+    return true;
+}
+
+/*!
+ * Load a checkpoint written by writeCheckpoint. Must be called right after
+ * initialize: the SVFIR and SVFG must be the ones the checkpoint came from.
+ */
+bool FlowSensitive::readCheckpoint(const std::string& filename)
+{
+    outs() << "Resuming " << PTAName() << " from checkpoint '" << filename << "'...";
+
+    ifstream F(filename.c_str());
+    if (!F.is_open())
+    {
+        outs() << "  error opening file for reading!\n";
+        return false;
+    }
+
+    string line;
+    getline(F, line);
+    istringstream header(line);
+    string magic, name;
+    u32_t iteration = 0;
+    header >> magic >> name >> iteration;
+    if (magic != "fs-checkpoint" || name != PTAName())
+    {
+        outs() << "  not a checkpoint of " << PTAName() << "!\n";
+        return false;
+    }
+
+    CallEdgeMap newEdges;
+    while (getline(F, line))
+    {
+        if (line.empty()) continue;
+
+        istringstream ss(line);
+        string tag;
+        ss >> tag;
+        if (tag == "gep")
+        {
+            NodeID id, base;
+            s32_t offset;
+            ss >> id >> base >> offset;
+            NodeID n = getGepObjVar(base, LocationSet(offset));
+            assert(id == n && "FS checkpoint: SVFIR differs from the checkpointed one!");
+            (void)n;
+        }
+        else if (tag == "fi")
+        {
+            NodeID base;
+            ss >> base;
+            setObjFieldInsensitive(base);
+        }
+        else if (tag == "tl")
+        {
+            NodeID var;
+            ss >> var;
+            unionPts(var, readCheckpointPts(ss));
+        }
+        else if (tag == "cg")
+        {
+            NodeID csId, calleeId;
+            ss >> csId >> calleeId;
+            const CallICFGNode* cs = SVFUtil::cast<CallICFGNode>(pag->getICFG()->getICFGNode(csId));
+            const SVFFunction* callee = ptaCallGraph->getCallGraphNode(calleeId)->getFunction();
+            if (getIndCallMap()[cs].insert(callee).second)
+            {
+                newEdges[cs].insert(callee);
+                ptaCallGraph->addIndirectCallGraphEdge(cs, cs->getCaller(), callee);
+            }
+        }
+        else if (!readCheckpointLine(tag, ss))
+        {
+            assert(false && "FS checkpoint: unknown entry!");
+        }
+    }
+    F.close();
+
+    // Reconnect the SVFG for the resolved indirect calls once all points-to
+    // sets are in place; this only re-propagates what is already known.
+    SVFGEdgeSetTy svfgEdges;
+    connectCallerAndCallee(newEdges, svfgEdges);
+    updateConnectedNodes(svfgEdges);
+
+    numOfIteration = iteration;
+
+    outs() << "\n";
+    return true;
+}
@@ -0,0 +1,722 @@
+//===- FlowSensitiveIncremental.cpp -- Incremental flow-sensitive PTA ---------//
+//
+//                     SVF: Static Value-Flow Analysis
+//
+// Copyright (C) <2013-2017>  <Yulei Sui>
+//
+
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+//
+//===----------------------------------------------------------------------===//
+
+/*
+ * FlowSensitiveIncremental.cpp
+ *
+ * Re-analysing a changed program from a snapshot of the flow-sensitive
+ * analysis of a previous version of it.
+ *
+ * SVFIR variables and SVFG nodes are matched across the two versions by keys
+ * built from LLVM values (names, or function and position) rather than IDs.
+ * SVFG nodes which are new, changed, lost an incoming edge, or whose function
+ * changed are the sources of the change; every node reachable from them in
+ * either version of the SVFG (indirect calls included) is invalidated. All
+ * other nodes have the same points-to sets as before, so they are restored
+ * from the snapshot and only invalidated nodes are solved again.
+ */
+
+#include "Util/Options.h"
+#include "WPA/Andersen.h"
+#include "WPA/FlowSensitive.h"
+#include <algorithm>
+#include <fstream>
+#include <sstream>
+
+using namespace SVF;
+using namespace SVFUtil;
+using namespace std;
+
+// Format of file (one entry per line)
+// fs-snapshot <PTA name>
+// fn <name key> <body key>                     fingerprint of each function
+// var <id> <key>                               SVFIR variables (no GepObjVars)
+// gep <id> <base id> <field index>             GepObjVars, in ID order
+// node <id> <key>                              SVFG nodes
+// edge <src> <dst> <key> <indirect call?>      SVFG edges
+// tl <var> { <pts> }                           top-level points-to sets
+// in/out <svfg node> <var> { <pts> }           address-taken points-to sets
+
+namespace
+{
+
+/// 64-bit FNV-1a, which unlike std::hash is the same for every build.
+u64_t fingerprint(const std::string& str)
+{
+    u64_t hash = 14695981039346656037ULL;
+    for (unsigned char c : str)
+    {
+        hash ^= c;
+        hash *= 1099511628211ULL;
+    }
+    return hash;
+}
+
+/*!
+ * Keys identifying SVFIR variables and SVFG nodes across versions of a
+ * program. A key of 0 means the variable/node cannot be identified.
+ */
+class SnapshotKeys
+{
+public:
+    SnapshotKeys(SVFIR* p, SVFG* g) : pag(p), svfg(g)
+    {
+        SVFModule* module = pag->getModule();
+        for (SVFModule::llvm_const_iterator it = module->llvmFunBegin(), eit = module->llvmFunEnd(); it != eit; ++it)
+        {
+            const Function* fun = *it;
+            u32_t idx = 0;
+            for (const BasicBlock& bb : *fun)
+                for (const Instruction& inst : bb)
+                    instIdx[&inst] = idx++;
+
+            std::string str;
+            raw_string_ostream rawstr(str);
+            fun->print(rawstr);
+            funKeys[fingerprint(fun->getName().str())] = fingerprint(rawstr.str());
+        }
+    }
+
+    /// Function name key -> function body key
+    const Map<u64_t, u64_t>& getFunKeys() const
+    {
+        return funKeys;
+    }
+
+    u64_t getFunKey(const SVFFunction* fun) const
+    {
+        return fingerprint(fun->getName());
+    }
+
+    u64_t getVarKey(NodeID id)
+    {
+        Map<NodeID, u64_t>::const_iterator it = varKeys.find(id);
+        if (it != varKeys.end())
+            return it->second;
+
+        u64_t key = 0;
+        const PAGNode* var = pag->getGNode(id);
+        if (SymbolTableInfo::isBlkPtr(id) || SymbolTableInfo::isNullPtr(id)
+                || SymbolTableInfo::isBlkObjOrConstantObj(id))
+            key = fingerprint("S" + std::to_string(id));
+        else if (const GepObjVar* gepObj = SVFUtil::dyn_cast<GepObjVar>(var))
+        {
+            u64_t baseKey = getVarKey(gepObj->getBaseNode());
+            if (baseKey != 0)
+                key = fingerprint("GO" + std::to_string(baseKey) + "#" + std::to_string(gepObj->getConstantFieldIdx()));
+        }
+        else if (SVFUtil::isa<RetPN>(var) || SVFUtil::isa<VarArgPN>(var))
+            key = fingerprint((SVFUtil::isa<RetPN>(var) ? "R" : "VA") + var->getValueName());
+        else if (SVFUtil::isa<DummyValVar>(var) || SVFUtil::isa<DummyObjVar>(var) || !var->hasValue())
+            key = 0;
+        else
+        {
+            std::string valKey = getValueKey(var->getValue());
+            if (!valKey.empty())
+            {
+                if (const GepValVar* gepVal = SVFUtil::dyn_cast<GepValVar>(var))
+                    key = fingerprint("GV" + valKey + "#" + std::to_string(gepVal->getConstantFieldIdx()));
+                else
+                    key = fingerprint((SVFUtil::isa<ObjVar>(var) ? "O" : "V") + valKey);
+            }
+        }
+
+        varKeys[id] = key;
+        return key;
+    }
+
+    u64_t getNodeKey(const SVFGNode* node)
+    {
+        std::string icfgKey = getICFGNodeKey(node->getICFGNode());
+        if (icfgKey.empty())
+            return 0;
+
+        std::ostringstream key;
+        key << node->getNodeKind() << "|" << icfgKey << "|";
+
+        NodeBS vars;
+        if (const StmtSVFGNode* stmt = SVFUtil::dyn_cast<StmtSVFGNode>(node))
+        {
+            const PAGEdge* edge = stmt->getPAGEdge();
+            key << edge->getEdgeKind() << "|";
+            if (const GepStmt* gep = SVFUtil::dyn_cast<GepStmt>(edge))
+                key << gep->isConstantOffset() << "|" << gep->getLocationSet().accumulateConstantFieldIdx() << "|";
+            // Source and destination, in this order.
+            u64_t srcKey = getVarKey(stmt->getPAGSrcNodeID());
+            u64_t dstKey = getVarKey(stmt->getPAGDstNodeID());
+            if (srcKey == 0 || dstKey == 0)
+                return 0;
+            key << srcKey << "|" << dstKey;
+            return fingerprint(key.str());
+        }
+        else if (const MRSVFGNode* mr = SVFUtil::dyn_cast<MRSVFGNode>(node))
+            vars = mr->getPointsTo();
+        else if (const ActualParmSVFGNode* ap = SVFUtil::dyn_cast<ActualParmSVFGNode>(node))
+            vars.set(ap->getParam()->getId());
+        else if (const FormalRetSVFGNode* fr = SVFUtil::dyn_cast<FormalRetSVFGNode>(node))
+            vars.set(fr->getRet()->getId());
+        else if (const NullPtrSVFGNode* np = SVFUtil::dyn_cast<NullPtrSVFGNode>(node))
+            vars.set(np->getPAGNode()->getId());
+        else
+            vars = node->getDefSVFVars();
+
+        u64_t varsKey = getVarsKey(vars);
+        if (varsKey == 0)
+            return 0;
+        key << varsKey;
+        return fingerprint(key.str());
+    }
+
+    /// Edge kind and, for indirect edges, the objects they carry.
+    u64_t getEdgeKey(const SVFGEdge* edge)
+    {
+        std::string key = std::to_string(edge->getEdgeKind());
+        if (const IndirectSVFGEdge* indEdge = SVFUtil::dyn_cast<IndirectSVFGEdge>(edge))
+        {
+            u64_t varsKey = getVarsKey(indEdge->getPointsTo());
+            if (varsKey == 0)
+                return 0;
+            key += "|" + std::to_string(varsKey);
+        }
+        return fingerprint(key);
+    }
+
+    /// Whether edge connects an indirect call site and a callee, i.e., whether
+    /// the analysis rather than the SVFG builder may have added it.
+    bool isIndirectCallEdge(const SVFGEdge* edge) const
+    {
+        CallSiteID csId;
+        if (const CallDirSVFGEdge* e = SVFUtil::dyn_cast<CallDirSVFGEdge>(edge))
+            csId = e->getCallSiteId();
+        else if (const CallIndSVFGEdge* e = SVFUtil::dyn_cast<CallIndSVFGEdge>(edge))
+            csId = e->getCallSiteId();
+        else if (const RetDirSVFGEdge* e = SVFUtil::dyn_cast<RetDirSVFGEdge>(edge))
+            csId = e->getCallSiteId();
+        else if (const RetIndSVFGEdge* e = SVFUtil::dyn_cast<RetIndSVFGEdge>(edge))
+            csId = e->getCallSiteId();
+        else
+            return false;
+
+        return pag->isIndirectCallSites(svfg->getCallSite(csId));
+    }
+
+private:
+    u64_t getVarsKey(const NodeBS& vars)
+    {
+        std::vector<u64_t> keys;
+        for (NodeID var : vars)
+        {
+            u64_t key = getVarKey(var);
+            if (key == 0)
+                return 0;
+            keys.push_back(key);
+        }
+        std::sort(keys.begin(), keys.end());
+
+        std::string key = "{";
+        for (u64_t k : keys)
+            key += std::to_string(k) + ",";
+        return fingerprint(key);
+    }
+
+    std::string getICFGNodeKey(const ICFGNode* node) const
+    {
+        if (node == nullptr)
+            return "N";
+        if (SVFUtil::isa<GlobalICFGNode>(node))
+            return "G";
+        if (const IntraICFGNode* intra = SVFUtil::dyn_cast<IntraICFGNode>(node))
+            return prefixed("I", getValueKey(intra->getInst()));
+        if (const CallICFGNode* call = SVFUtil::dyn_cast<CallICFGNode>(node))
+            return prefixed("C", getValueKey(call->getCallSite()));
+        if (const RetICFGNode* ret = SVFUtil::dyn_cast<RetICFGNode>(node))
+            return prefixed("R", getValueKey(ret->getCallSite()));
+        if (const FunEntryICFGNode* entry = SVFUtil::dyn_cast<FunEntryICFGNode>(node))
+            return "EN" + entry->getFun()->getName();
+        if (const FunExitICFGNode* exit = SVFUtil::dyn_cast<FunExitICFGNode>(node))
+            return "EX" + exit->getFun()->getName();
+        return "";
+    }
+
+    std::string getValueKey(const Value* val) const
+    {
+        if (const Function* fun = SVFUtil::dyn_cast<Function>(val))
+            return "F" + fun->getName().str();
+        if (const GlobalValue* global = SVFUtil::dyn_cast<GlobalValue>(val))
+            return global->hasName() ? "G" + global->getName().str() : "";
+        if (const Argument* arg = SVFUtil::dyn_cast<Argument>(val))
+            return "A" + arg->getParent()->getName().str() + "#" + std::to_string(arg->getArgNo());
+        if (const Instruction* inst = SVFUtil::dyn_cast<Instruction>(val))
+        {
+            Map<const Instruction*, u32_t>::const_iterator it = instIdx.find(inst);
+            if (it == instIdx.end())
+                return "";
+            return "I" + inst->getFunction()->getName().str() + "#" + std::to_string(it->second);
+        }
+        if (SVFUtil::isa<Constant>(val))
+        {
+            std::string str;
+            raw_string_ostream rawstr(str);
+            val->print(rawstr);
+            return "K" + rawstr.str();
+        }
+        return "";
+    }
+
+    static std::string prefixed(const std::string& prefix, const std::string& key)
+    {
+        return key.empty() ? key : prefix + key;
+    }
+
+    SVFIR* pag;
+    SVFG* svfg;
+    Map<const Instruction*, u32_t> instIdx;
+    Map<u64_t, u64_t> funKeys;
+    Map<NodeID, u64_t> varKeys;
+};
+
+/// Map keys to IDs, forgetting keys which are not unique.
+void addKey(Map<u64_t, NodeID>& keyToId, Set<u64_t>& ambiguous, u64_t key, NodeID id)
+{
+    if (key == 0 || ambiguous.count(key))
+        return;
+    if (!keyToId.emplace(key, id).second)
+    {
+        keyToId.erase(key);
+        ambiguous.insert(key);
+    }
+}
+
+/// The top-level variable node defines, if any.
+const PAGNode* getDefinedVar(const SVFGNode* node)
+{
+    if (SVFUtil::isa<StoreSVFGNode>(node))
+        return nullptr;
+    if (const StmtSVFGNode* stmt = SVFUtil::dyn_cast<StmtSVFGNode>(node))
+        return stmt->getPAGDstNode();
+    if (const PHISVFGNode* phi = SVFUtil::dyn_cast<PHISVFGNode>(node))
+        return phi->getRes();
+    if (const CmpVFGNode* cmp = SVFUtil::dyn_cast<CmpVFGNode>(node))
+        return cmp->getRes();
+    if (const BinaryOPVFGNode* binary = SVFUtil::dyn_cast<BinaryOPVFGNode>(node))
+        return binary->getRes();
+    if (const UnaryOPVFGNode* unary = SVFUtil::dyn_cast<UnaryOPVFGNode>(node))
+        return unary->getRes();
+    if (const FormalParmSVFGNode* fp = SVFUtil::dyn_cast<FormalParmSVFGNode>(node))
+        return fp->getParam();
+    if (const ActualRetSVFGNode* ar = SVFUtil::dyn_cast<ActualRetSVFGNode>(node))
+        return ar->getRev();
+    if (const NullPtrSVFGNode* np = SVFUtil::dyn_cast<NullPtrSVFGNode>(node))
+        return np->getPAGNode();
+    return nullptr;
+}
+
+bool isIncrementalSupported(const PointerAnalysis* pta)
+{
+    if (pta->getAnalysisTy() != PointerAnalysis::FSSPARSE_WPA || Options::OPTSVFG)
+    {
+        outs() << "  incremental analysis is only supported by FlowSensitive without -opt-svfg!\n";
+        return false;
+    }
+    return true;
+}
+
+} // End anonymous namespace
+
+/*!
+ * Write the solved analysis, and what is needed to match it to a later
+ * version of the program.
+ */
+void FlowSensitive::writeSnapshot(const std::string& filename)
+{
+    outs() << "Writing " << PTAName() << " snapshot to '" << filename << "'...";
+    if (!isIncrementalSupported(this))
+        return;
+
+    std::fstream f(filename.c_str(), std::ios_base::out);
+    if (!f.good())
+    {
+        outs() << "  error opening file for writing!\n";
+        return;
+    }
+
+    SnapshotKeys keys(pag, svfg);
+
+    f << "fs-snapshot " << PTAName() << "\n";
+
+    for (const Map<u64_t, u64_t>::value_type& funKey : keys.getFunKeys())
+        f << "fn " << funKey.first << " " << funKey.second << "\n";
+
+    OrderedMap<NodeID, const GepObjVar*> gepObjs;
+    for (SVFIR::iterator it = pag->begin(), eit = pag->end(); it != eit; ++it)
+    {
+        if (const GepObjVar* gepObj = SVFUtil::dyn_cast<GepObjVar>(it->second))
+            gepObjs[it->first] = gepObj;
+        else if (u64_t key = keys.getVarKey(it->first))
+            f << "var " << it->first << " " << key << "\n";
+    }
+
+    for (const OrderedMap<NodeID, const GepObjVar*>::value_type& idGep : gepObjs)
+    {
+        f << "gep " << idGep.first << " " << idGep.second->getBaseNode()
+          << " " << idGep.second->getConstantFieldIdx() << "\n";
+    }
+
+    for (SVFG::iterator it = svfg->begin(), eit = svfg->end(); it != eit; ++it)
+    {
+        if (u64_t key = keys.getNodeKey(it->second))
+            f << "node " << it->first << " " << key << "\n";
+    }
+
+    for (SVFG::iterator it = svfg->begin(), eit = svfg->end(); it != eit; ++it)
+    {
+        for (const SVFGEdge* edge : it->second->getOutEdges())
+        {
+            f << "edge " << edge->getSrcID() << " " << edge->getDstID() << " "
+              << keys.getEdgeKey(edge) << " " << keys.isIndirectCallEdge(edge) << "\n";
+        }
+    }
+
+    for (SVFIR::iterator it = pag->begin(), eit = pag->end(); it != eit; ++it)
+    {
+        const PointsTo& pts = getPts(it->first);
+        if (pts.empty()) continue;
+        f << "tl " << it->first << " ";
+        writeCheckpointPts(f, pts);
+        f << "\n";
+    }
+
+    writeCheckpointATPts(f);
+
+    f.close();
+    if (!f.good())
+    {
+        outs() << "  error writing file!\n";
+        return;
+    }
+
+    outs() << "\n";
+}
+
+/*!
+ * Restore everything in a snapshot of a previous version of the program
+ * which is unaffected by the changes since, and push the affected SVFG nodes
+ * (and their predecessors, which feed them) into the worklist.
+ * Must be called right after initialize.
+ */
+bool FlowSensitive::readSnapshot(const std::string& filename)
+{
+    outs() << "Re-analysing " << PTAName() << " incrementally from snapshot '" << filename << "'...";
+    if (!isIncrementalSupported(this))
+        return false;
+
+    ifstream F(filename.c_str());
+    if (!F.is_open())
+    {
+        outs() << "  error opening file for reading!\n";
+        return false;
+    }
+
+    string line;
+    getline(F, line);
+    istringstream header(line);
+    string magic, name;
+    header >> magic >> name;
+    if (magic != "fs-snapshot" || name != PTAName())
+    {
+        outs() << "  not a snapshot of " << PTAName() << "!\n";
+        return false;
+    }
+
+    /// Keys of this version of the program.
+    SnapshotKeys keys(pag, svfg);
+    Map<u64_t, NodeID> keyToVar, keyToNode;
+    Set<u64_t> ambiguousVars, ambiguousNodes;
+    for (SVFIR::iterator it = pag->begin(), eit = pag->end(); it != eit; ++it)
+    {
+        if (!SVFUtil::isa<GepObjVar>(it->second))
+            addKey(keyToVar, ambiguousVars, keys.getVarKey(it->first), it->first);
+    }
+    for (SVFG::iterator it = svfg->begin(), eit = svfg->end(); it != eit; ++it)
+        addKey(keyToNode, ambiguousNodes, keys.getNodeKey(it->second), it->first);
+
+    /// Old ID -> new ID
+    Map<NodeID, NodeID> varMap, nodeMap;
+    NodeBS mappedNodes;
+    Map<u64_t, u64_t> oldFunKeys;
+    typedef std::tuple<NodeID, NodeID, u64_t> EdgeTuple;
+    OrderedSet<EdgeTuple> oldEdges;
+    Map<NodeID, NodeBS> oldSuccs;
+    NodeBS sources;
+    /// Points-to sets of variables/locations which still exist. Those which
+    /// cannot be mapped (.second false) must be invalidated.
+    std::vector<std::pair<std::pair<NodeID, PointsTo>, bool>> tlPts;
+    std::vector<std::pair<std::tuple<bool, NodeID, NodeID, PointsTo>, bool>> atPts;
+
+    auto mapPts = [&](const PointsTo& pts, PointsTo& mapped)
+    {
+        for (NodeID o : pts)
+        {
+            Map<NodeID, NodeID>::const_iterator it = varMap.find(o);
+            if (it == varMap.end())
+                return false;
+            mapped.set(it->second);
+        }
+        return true;
+    };
+
+    while (getline(F, line))
+    {
+        if (line.empty()) continue;
+
+        istringstream ss(line);
+        string tag;
+        ss >> tag;
+        if (tag == "fn")
+        {
+            u64_t funKey, bodyKey;
+            ss >> funKey >> bodyKey;
+            oldFunKeys[funKey] = bodyKey;
+        }
+        else if (tag == "var")
+        {
+            NodeID id;
+            u64_t key;
+            ss >> id >> key;
+            Map<u64_t, NodeID>::const_iterator it = keyToVar.find(key);
+            if (it != keyToVar.end())
+                varMap[id] = it->second;
+        }
+        else if (tag == "gep")
+        {
+            NodeID id, base;
+            s32_t offset;
+            ss >> id >> base >> offset;
+            Map<NodeID, NodeID>::const_iterator it = varMap.find(base);
+            if (it != varMap.end())
+                varMap[id] = getGepObjVar(it->second, LocationSet(offset));
+        }
+        else if (tag == "node")
+        {
+            NodeID id;
+            u64_t key;
+            ss >> id >> key;
+            Map<u64_t, NodeID>::const_iterator it = keyToNode.find(key);
+            if (it != keyToNode.end())
+            {
+                nodeMap[id] = it->second;
+                mappedNodes.set(it->second);
+            }
+        }
+        else if (tag == "edge")
+        {
+            NodeID src, dst;
+            u64_t key;
+            bool indCall;
+            ss >> src >> dst >> key >> indCall;
+            Map<NodeID, NodeID>::const_iterator srcIt = nodeMap.find(src);
+            Map<NodeID, NodeID>::const_iterator dstIt = nodeMap.find(dst);
+            if (dstIt == nodeMap.end())
+                continue;
+            // Whatever flowed from a node which is gone has to be undone.
+            if (srcIt == nodeMap.end())
+                sources.set(dstIt->second);
+            else
+            {
+                oldSuccs[srcIt->second].set(dstIt->second);
+                if (!indCall)
+                    oldEdges.insert(EdgeTuple(srcIt->second, dstIt->second, key));
+            }
+        }
+        else if (tag == "tl")
+        {
+            NodeID var;
+            ss >> var;
+            PointsTo pts = readCheckpointPts(ss), mapped;
+            Map<NodeID, NodeID>::const_iterator it = varMap.find(var);
+            if (it != varMap.end())
+            {
+                bool ok = mapPts(pts, mapped);
+                tlPts.push_back(std::make_pair(std::make_pair(it->second, mapped), ok));
+            }
+        }
+        else if (tag == "in" || tag == "out")
+        {
+            NodeID loc, var;
+            ss >> loc >> var;
+            PointsTo pts = readCheckpointPts(ss), mapped;
+            Map<NodeID, NodeID>::const_iterator locIt = nodeMap.find(loc);
+            Map<NodeID, NodeID>::const_iterator varIt = varMap.find(var);
+            if (locIt != nodeMap.end() && varIt != varMap.end())
+            {
+                bool ok = mapPts(pts, mapped);
+                atPts.push_back(std::make_pair(std::make_tuple(tag == "in", locIt->second, varIt->second, mapped), ok));
+            }
+        }
+        else
+        {
+            assert(false && "FS snapshot: unknown entry!");
+        }
+    }
+    F.close();
+
+    /// Sources: nodes which are new or in a changed function, and targets of
+    /// edges which are new or gone (except indirect call edges, which the
+    /// analysis adds and are handled below).
+    const Map<u64_t, u64_t>& funKeys = keys.getFunKeys();
+    Map<const ICFGNode*, NodeBS> icfgNodeToSVFGNodes;
+    Map<NodeID, NodeBS> varToDefNodes;
+    for (SVFG::iterator it = svfg->begin(), eit = svfg->end(); it != eit; ++it)
+    {
+        const SVFGNode* node = it->second;
+        const ICFGNode* icfgNode = node->getICFGNode();
+        if (icfgNode != nullptr)
+            icfgNodeToSVFGNodes[icfgNode].set(it->first);
+        if (const PAGNode* var = getDefinedVar(node))
+            varToDefNodes[var->getId()].set(it->first);
+
+        if (!mappedNodes.test(it->first))
+            sources.set(it->first);
+        else if (icfgNode != nullptr && icfgNode->getFun() != nullptr)
+        {
+            u64_t funKey = keys.getFunKey(icfgNode->getFun());
+            Map<u64_t, u64_t>::const_iterator oldIt = oldFunKeys.find(funKey);
+            Map<u64_t, u64_t>::const_iterator newIt = funKeys.find(funKey);
+            if (oldIt == oldFunKeys.end() || newIt == funKeys.end() || oldIt->second != newIt->second)
+                sources.set(it->first);
+        }
+
+        for (const SVFGEdge* edge : node->getOutEdges())
+        {
+            if (keys.isIndirectCallEdge(edge))
+                continue;
+            EdgeTuple e(edge->getSrcID(), edge->getDstID(), keys.getEdgeKey(edge));
+            if (std::get<2>(e) == 0 || oldEdges.erase(e) == 0)
+                sources.set(edge->getDstID());
+        }
+    }
+    for (const EdgeTuple& e : oldEdges)
+        sources.set(std::get<1>(e));
+
+    /// Indirect calls whose function pointer is invalidated may have new
+    /// or fewer callees: their actuals and all their callees' formals are
+    /// invalidated.
+    Map<NodeID, std::vector<const CallICFGNode*>> funPtrToCallSites;
+    for (const CallSiteToFunPtrMap::value_type& csfp : pag->getIndirectCallsites())
+        funPtrToCallSites[csfp.second].push_back(csfp.first);
+    Map<NodeID, NodeBS> defNodeToIndCallNodes;
+    for (const Map<NodeID, std::vector<const CallICFGNode*>>::value_type& fpcs : funPtrToCallSites)
+    {
+        Map<NodeID, NodeBS>::const_iterator defIt = varToDefNodes.find(fpcs.first);
+        if (defIt == varToDefNodes.end())
+            continue;
+
+        NodeBS callNodes;
+        for (const CallICFGNode* cs : fpcs.second)
+        {
+            callNodes |= icfgNodeToSVFGNodes[cs];
+            callNodes |= icfgNodeToSVFGNodes[cs->getRetICFGNode()];
+            for (const SVFFunction* callee : ander->getIndCallMap()[cs])
+            {
+                callNodes |= icfgNodeToSVFGNodes[pag->getICFG()->getFunEntryICFGNode(callee)];
+                callNodes |= icfgNodeToSVFGNodes[pag->getICFG()->getFunExitICFGNode(callee)];
+            }
+        }
+        for (NodeID def : defIt->second)
+            defNodeToIndCallNodes[def] |= callNodes;
+    }
+
+    /// Invalidate everything reachable from the sources in either version.
+    NodeBS invalid;
+    std::vector<NodeID> stack;
+    auto invalidate = [&](NodeID id)
+    {
+        if (invalid.test_and_set(id))
+            stack.push_back(id);
+    };
+    for (NodeID id : sources)
+        invalidate(id);
+    while (!stack.empty())
+    {
+        NodeID id = stack.back();
+        stack.pop_back();
+        for (const SVFGEdge* edge : svfg->getSVFGNode(id)->getOutEdges())
+            invalidate(edge->getDstID());
+
+        Map<NodeID, NodeBS>::const_iterator succIt = oldSuccs.find(id);
+        if (succIt != oldSuccs.end())
+            for (NodeID succ : succIt->second)
+                invalidate(succ);
+
+        Map<NodeID, NodeBS>::const_iterator callIt = defNodeToIndCallNodes.find(id);
+        if (callIt != defNodeToIndCallNodes.end())
+            for (NodeID callNode : callIt->second)
+                invalidate(callNode);
+    }
+
+    /// Restore what is unaffected, which should all be mappable.
+    auto isRestorable = [&](NodeID var)
+    {
+        Map<NodeID, NodeBS>::const_iterator defIt = varToDefNodes.find(var);
+        return defIt != varToDefNodes.end() && !defIt->second.intersects(invalid);
+    };
+    bool complete = true;
+    for (const std::pair<std::pair<NodeID, PointsTo>, bool>& varPts : tlPts)
+        complete &= varPts.second || !isRestorable(varPts.first.first);
+    for (const std::pair<std::tuple<bool, NodeID, NodeID, PointsTo>, bool>& locPts : atPts)
+        complete &= locPts.second || invalid.test(std::get<1>(locPts.first));
+    if (!complete)
+    {
+        outs() << "  snapshot does not match the program, solving from scratch!\n";
+        return false;
+    }
+
+    for (const std::pair<std::pair<NodeID, PointsTo>, bool>& varPts : tlPts)
+    {
+        if (isRestorable(varPts.first.first))
+            unionPts(varPts.first.first, varPts.first.second);
+    }
+    for (const std::pair<std::tuple<bool, NodeID, NodeID, PointsTo>, bool>& locPts : atPts)
+    {
+        bool in;
+        NodeID loc, var;
+        PointsTo pts;
+        std::tie(in, loc, var, pts) = locPts.first;
+        if (invalid.test(loc))
+            continue;
+        if (in)
+            getDFPTDataTy()->unionDFInPts(loc, var, pts);
+        else
+            getDFPTDataTy()->unionDFOutPts(loc, var, pts);
+    }
+
+    /// Solve the invalidated nodes again, starting from what flows into them.
+    NodeBS worklistNodes = invalid;
+    for (NodeID id : invalid)
+        for (const SVFGEdge* edge : svfg->getSVFGNode(id)->getInEdges())
+            worklistNodes.set(edge->getSrcID());
+    for (NodeID id : worklistNodes)
+        pushIntoWorklist(id);
+
+    outs() << " (" << invalid.count() << " of " << svfg->getTotalNodeNum() << " SVFG nodes invalidated)\n";
+    return true;
+}
@@ -166,8 +166,20 @@ void FlowSensitiveStat::performStat()
     PTNumStatMap[NumOfStores] = numOfStore;
 
     PTNumStatMap[NumOfIterations] = fspta->numOfIteration;
+    PTNumStatMap["NodeVisits"] = fspta->getNumOfNodeVisits();
+    PTNumStatMap["VisitedNodes"] = fspta->getNumOfVisitedNodes();
+    PTNumStatMap["MaxNodeVisits"] = fspta->getMaxNodeVisits();
+    timeStatMap["AvgNodeVisits"] = fspta->getNumOfVisitedNodes() == 0 ? 0 :
+                                   (double)fspta->getNumOfNodeVisits() / fspta->getNumOfVisitedNodes();
 
     PTNumStatMap[NumOfIndirectEdgeSolved] = fspta->getNumOfResolvedIndCallEdge();
+    PTNumStatMap["CGUpdateBatches"] = fspta->numOfCGUpdates;
+    PTNumStatMap["BatchedCallEdges"] = fspta->numOfNewCallEdges;
+    PTNumStatMap["MaxCallEdgeBatch"] = fspta->maxNewCallEdges;
+    PTNumStatMap["BatchedSVFGEdges"] = fspta->numOfNewSVFGEdges;
+    PTNumStatMap["MaxSVFGEdgeBatch"] = fspta->maxNewSVFGEdges;
+    if (fspta->demandDriven)
+        PTNumStatMap["QuerySliceNodes"] = fspta->querySlice.count();
 
     PTNumStatMap[NumOfNullPointer] = _NumOfNullPtr;
     PTNumStatMap["PointsToConstPtr"] = _NumOfConstantPtr;
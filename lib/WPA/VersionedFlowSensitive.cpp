@@ -567,17 +567,7 @@ void VersionedFlowSensitive::propagateVersion(const NodeID o, const Version v, c
     {
         // o:vp has changed.
         // Add the dummy propagation node to tell the solver to propagate it later.
-        const DummyVersionPropSVFGNode *dvp = nullptr;
-        VarToPropNodeMap::const_iterator dvpIt = versionedVarToPropNode.find(dstVar);
-        if (dvpIt == versionedVarToPropNode.end())
-        {
-            dvp = svfg->addDummyVersionPropSVFGNode(o, vp);
-            versionedVarToPropNode[dstVar] = dvp;
-        }
-        else dvp = dvpIt->second;
-
-        assert(dvp != nullptr && "VFS::propagateVersion: propagation dummy node not found?");
-        pushIntoWorklist(dvp->getId());
+        pushIntoWorklist(getVersionPropNode(o, vp)->getId());
 
         // Notify nodes which rely on o:vp that it changed.
         for (NodeID s : getStmtReliance(o, vp)) pushIntoWorklist(s);
@@ -587,6 +577,22 @@ void VersionedFlowSensitive::propagateVersion(const NodeID o, const Version v, c
     if (time) versionPropTime += (end - start) / TIMEINTERVAL;
 }
 
+const DummyVersionPropSVFGNode *VersionedFlowSensitive::getVersionPropNode(const NodeID o, const Version v)
+{
+    const VersionedVar var = atKey(o, v);
+    const DummyVersionPropSVFGNode *dvp = nullptr;
+    VarToPropNodeMap::const_iterator dvpIt = versionedVarToPropNode.find(var);
+    if (dvpIt == versionedVarToPropNode.end())
+    {
+        dvp = svfg->addDummyVersionPropSVFGNode(o, v);
+        versionedVarToPropNode[var] = dvp;
+    }
+    else dvp = dvpIt->second;
+
+    assert(dvp != nullptr && "VFS::getVersionPropNode: propagation dummy node not found?");
+    return dvp;
+}
+
 void VersionedFlowSensitive::processNode(NodeID n)
 {
     SVFGNode* sn = svfg->getSVFGNode(n);
@@ -790,6 +796,66 @@ void VersionedFlowSensitive::cluster(void)
     PointsTo::setCurrentBestNodeMapping(nodeMapping, reverseNodeMapping);
 }
 
+void VersionedFlowSensitive::writeCheckpointATPts(std::ostream& os)
+{
+    // Every versioned variable is o:v where v is consumed or yielded somewhere
+    // for o (or for the object o is equivalent to).
+    Map<NodeID, Set<Version>> objVersions;
+    for (const LocVersionMap *lvm : { &consume, &yield })
+    {
+        for (const ObjToVersionMap &ovm : *lvm)
+        {
+            for (const ObjToVersionMap::value_type &ov : ovm) objVersions[ov.first].insert(ov.second);
+        }
+    }
+
+    for (SVFIR::iterator it = pag->begin(); it != pag->end(); ++it)
+    {
+        if (!SVFUtil::isa<ObjVar>(it->second)) continue;
+
+        const NodeID o = it->first;
+        const Map<NodeID, NodeID>::const_iterator canonObjectIt = equivalentObject.find(o);
+        const NodeID op = canonObjectIt == equivalentObject.end() ? o : canonObjectIt->second;
+        const Map<NodeID, Set<Version>>::const_iterator versionsIt = objVersions.find(op);
+        if (versionsIt == objVersions.end()) continue;
+
+        for (const Version v : versionsIt->second)
+        {
+            const PointsTo &pts = vPtD->getPts(atKey(o, v));
+            if (pts.empty()) continue;
+            os << "vat " << o << " " << v << " ";
+            writeCheckpointPts(os, pts);
+            os << "\n";
+        }
+    }
+}
+
+void VersionedFlowSensitive::writeCheckpointWorklistNode(std::ostream& os, NodeID id)
+{
+    const DummyVersionPropSVFGNode *dvp = SVFUtil::dyn_cast<DummyVersionPropSVFGNode>(svfg->getSVFGNode(id));
+    if (dvp != nullptr) os << "wlv " << dvp->getObject() << " " << dvp->getVersion() << "\n";
+    else FlowSensitive::writeCheckpointWorklistNode(os, id);
+}
+
+bool VersionedFlowSensitive::readCheckpointLine(const std::string& tag, std::istream& is)
+{
+    NodeID o;
+    Version v;
+    if (tag == "vat")
+    {
+        is >> o >> v;
+        vPtD->unionPts(atKey(o, v), readCheckpointPts(is));
+    }
+    else if (tag == "wlv")
+    {
+        is >> o >> v;
+        pushIntoWorklist(getVersionPropNode(o, v)->getId());
+    }
+    else return FlowSensitive::readCheckpointLine(tag, is);
+
+    return true;
+}
+
 Version VersionedFlowSensitive::getVersion(const NodeID l, const NodeID o, const LocVersionMap &lvm) const
 {
     const Map<NodeID, NodeID>::const_iterator canonObjectIt = equivalentObject.find(o);
@@ -117,6 +117,11 @@ void VersionedFlowSensitiveStat::performStat()
     PTNumStatMap[NumOfStores] = numOfStore;
 
     PTNumStatMap[NumOfIterations] = vfspta->numOfIteration;
+    PTNumStatMap["NodeVisits"] = vfspta->getNumOfNodeVisits();
+    PTNumStatMap["VisitedNodes"] = vfspta->getNumOfVisitedNodes();
+    PTNumStatMap["MaxNodeVisits"] = vfspta->getMaxNodeVisits();
+    timeStatMap["AvgNodeVisits"] = vfspta->getNumOfVisitedNodes() == 0 ? 0 :
+                                   (double)vfspta->getNumOfNodeVisits() / vfspta->getNumOfVisitedNodes();
 
     PTNumStatMap[NumOfIndirectEdgeSolved] = vfspta->getNumOfResolvedIndCallEdge();
 